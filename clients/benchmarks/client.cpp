@@ -144,6 +144,7 @@ try
     std::string initialization;
     hipblas_int device_id;
     hipblas_int parallel_devices;
+    int         api;
 
     bool datafile            = hipblas_parse_data(argc, argv);
     bool atomics_not_allowed = false;
@@ -156,44 +157,44 @@ try
     desc.add_options()
 
         ("sizem,m",
-         value<hipblas_int>(&arg.M)->default_value(128),
+         value<int64_t>(&arg.M)->default_value(128),
          "Specific matrix size: sizem is only applicable to BLAS-2 & BLAS-3: the number of "
          "rows or columns in matrix.")
 
         ("sizen,n",
-         value<hipblas_int>(&arg.N)->default_value(128),
+         value<int64_t>(&arg.N)->default_value(128),
          "Specific matrix/vector size: BLAS-1: the length of the vector. BLAS-2 & "
          "BLAS-3: the number of rows or columns in matrix")
 
         ("sizek,k",
-         value<hipblas_int>(&arg.K)->default_value(128),
+         value<int64_t>(&arg.K)->default_value(128),
          "Specific matrix size: BLAS-2: the number of sub or super-diagonals of A. BLAS-3: "
          "the number of columns in A and rows in B.")
 
         ("kl",
-         value<hipblas_int>(&arg.KL)->default_value(128),
+         value<int64_t>(&arg.KL)->default_value(128),
          "Specific matrix size: kl is only applicable to BLAS-2: The number of sub-diagonals "
          "of the banded matrix A.")
 
         ("ku",
-         value<hipblas_int>(&arg.KU)->default_value(128),
+         value<int64_t>(&arg.KU)->default_value(128),
          "Specific matrix size: ku is only applicable to BLAS-2: The number of super-diagonals "
          "of the banded matrix A.")
 
         ("lda",
-         value<hipblas_int>(&arg.lda)->default_value(128),
+         value<int64_t>(&arg.lda)->default_value(128),
          "Leading dimension of matrix A, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldb",
-         value<hipblas_int>(&arg.ldb)->default_value(128),
+         value<int64_t>(&arg.ldb)->default_value(128),
          "Leading dimension of matrix B, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldc",
-         value<hipblas_int>(&arg.ldc)->default_value(128),
+         value<int64_t>(&arg.ldc)->default_value(128),
          "Leading dimension of matrix C, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldd",
-         value<hipblas_int>(&arg.ldd)->default_value(128),
+         value<int64_t>(&arg.ldd)->default_value(128),
          "Leading dimension of matrix D, is only applicable to BLAS-EX ")
 
         ("stride_a",
@@ -227,11 +228,11 @@ try
          "BLAS_2: leading dimension.")
 
         ("incx",
-         value<hipblas_int>(&arg.incx)->default_value(1),
+         value<int64_t>(&arg.incx)->default_value(1),
          "increment between values in x vector")
 
         ("incy",
-         value<hipblas_int>(&arg.incy)->default_value(1),
+         value<int64_t>(&arg.incy)->default_value(1),
          "increment between values in y vector")
 
         ("alpha",
@@ -304,13 +305,26 @@ try
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm xtrsm_ex xtrsv xtrmm
 
         ("batch_count",
-         value<hipblas_int>(&arg.batch_count)->default_value(1),
+         value<int64_t>(&arg.batch_count)->default_value(1),
          "Number of matrices. Only applicable to batched and strided_batched routines")
 
+        ("group_count",
+         value<hipblas_int>(&arg.group_count)->default_value(3),
+         "Number of groups. Only applicable to grouped routines")
+
+        ("activation",
+         value<hipblas_int>(&arg.activation)->default_value(0),
+         "Activation of the epilogue. 0 = none, 1 = ReLU, 2 = GELU. Only applicable to gemm_ex_with_epilogue")
+
         ("inplace",
          value<bool>(&arg.inplace)->default_value(false),
          "Whether or not to use the in place version of the algorithm. Only applicable to trmm routines")
 
+        ("with_scalar_arrays",
+         value<bool>(&arg.with_scalar_arrays)->default_value(false),
+         "Whether or not to use one alpha and beta for each batch. Only applicable to gemm_strided_batched, "
+         "gemm_batched_ex and gemm_strided_batched_ex")
+
         ("verify,v",
          value<hipblas_int>(&arg.norm_check)->default_value(0),
          "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
@@ -363,6 +377,10 @@ try
          bool_switch(&arg.fortran)->default_value(false),
          "Run using Fortran interface")
 
+        ("api",
+         value<int>(&api)->default_value(0),
+         "Interface to call: 0 = C, 1 = Fortran, 2 = C _64 functions taking int64_t sizes")
+
         ("help,h", "produces this help message");
 
         //("version", "Prints the version number");
@@ -444,6 +462,10 @@ try
     if(arg.K < 0)
         throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
 
+    if(api < 0 || api > 2)
+        throw std::invalid_argument("Invalid value for --api " + std::to_string(api));
+    arg.api = hipblas_client_api(api);
+
     int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
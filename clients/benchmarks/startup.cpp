@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// hipblas-startup-bench measures what a short-lived process pays to start using hipBLAS.
+// Each iteration runs in a new process, which opens hipBLAS with dlopen and times:
+//   load    - dlopen of hipBLAS and the libraries it links, with all relocations done
+//   create  - hipblasCreate
+//   solver  - the first call to a solver function, hipblasSgetrf with n = 0, which
+//             loads rocSOLVER when it is loaded on first use
+//   destroy - hipblasDestroy
+// and whether rocSOLVER was mapped after the load and after the solver call.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <fstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+// hipBLAS is opened with dlopen, so only the signatures used are declared here
+typedef int (*hipblas_create_t)(void** handle);
+typedef int (*hipblas_destroy_t)(void* handle);
+typedef int (*hipblas_sgetrf_t)(void* handle, int n, float* A, int lda, int* ipiv, int* info);
+
+enum startup_phase
+{
+    phase_load,
+    phase_create,
+    phase_solver,
+    phase_destroy,
+    phase_count
+};
+
+static const char* phase_names[phase_count] = {"load", "create", "solver", "destroy"};
+
+struct startup_sample
+{
+    double us[phase_count];
+    bool   solver_mapped_after_load;
+    bool   solver_mapped_after_call;
+    bool   ok;
+};
+
+static bool rocsolver_mapped()
+{
+    std::ifstream maps("/proc/self/maps");
+    std::string   line;
+    while(std::getline(maps, line))
+        if(line.find("librocsolver") != std::string::npos)
+            return true;
+    return false;
+}
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+// Runs in the child process
+static startup_sample run_once(const char* library)
+{
+    startup_sample sample = {};
+
+    auto  start  = std::chrono::steady_clock::now();
+    void* handle = dlopen(library, RTLD_NOW | RTLD_LOCAL);
+    sample.us[phase_load] = elapsed_us(start);
+    if(!handle)
+    {
+        std::fprintf(stderr, "cannot load %s: %s\n", library, dlerror());
+        return sample;
+    }
+    sample.solver_mapped_after_load = rocsolver_mapped();
+
+    auto create  = (hipblas_create_t)dlsym(handle, "hipblasCreate");
+    auto destroy = (hipblas_destroy_t)dlsym(handle, "hipblasDestroy");
+    auto sgetrf  = (hipblas_sgetrf_t)dlsym(handle, "hipblasSgetrf");
+    if(!create || !destroy)
+    {
+        std::fprintf(stderr, "%s does not export hipblasCreate and hipblasDestroy\n", library);
+        return sample;
+    }
+
+    void* blas = nullptr;
+    start      = std::chrono::steady_clock::now();
+    if(create(&blas) != 0)
+    {
+        std::fprintf(stderr, "hipblasCreate failed\n");
+        return sample;
+    }
+    sample.us[phase_create] = elapsed_us(start);
+
+    // With a null info the call returns an error before any device work, so only
+    // the cost of reaching the solver library is measured
+    if(sgetrf)
+    {
+        start = std::chrono::steady_clock::now();
+        sgetrf(blas, 0, nullptr, 0, nullptr, nullptr);
+        sample.us[phase_solver] = elapsed_us(start);
+    }
+    sample.solver_mapped_after_call = rocsolver_mapped();
+
+    start = std::chrono::steady_clock::now();
+    destroy(blas);
+    sample.us[phase_destroy] = elapsed_us(start);
+
+    sample.ok = true;
+    return sample;
+}
+
+static bool run_in_child(const char* library, startup_sample& sample)
+{
+    int fds[2];
+    if(pipe(fds) != 0)
+        return false;
+
+    pid_t pid = fork();
+    if(pid < 0)
+        return false;
+    if(pid == 0)
+    {
+        close(fds[0]);
+        startup_sample child_sample = run_once(library);
+        ssize_t        written      = write(fds[1], &child_sample, sizeof(child_sample));
+        _exit(written == sizeof(child_sample) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    ssize_t bytes = read(fds[0], &sample, sizeof(sample));
+    close(fds[0]);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return bytes == sizeof(sample) && WIFEXITED(status) && WEXITSTATUS(status) == 0 && sample.ok;
+}
+
+static void usage(const char* program)
+{
+    std::printf("usage: %s [--iters N] [--library PATH]\n"
+                "  --iters N       number of processes to time (default 20)\n"
+                "  --library PATH  hipBLAS library to open (default %s)\n",
+                program,
+                HIPBLAS_LIBRARY_NAME);
+}
+
+int main(int argc, char* argv[])
+{
+    int         iters   = 20;
+    const char* library = HIPBLAS_LIBRARY_NAME;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(!std::strcmp(argv[i], "--iters") && i + 1 < argc)
+            iters = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "--library") && i + 1 < argc)
+            library = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return !std::strcmp(argv[i], "--help") || !std::strcmp(argv[i], "-h") ? 0 : 1;
+        }
+    }
+    if(iters < 1)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<startup_sample> samples;
+    for(int i = 0; i < iters; i++)
+    {
+        startup_sample sample;
+        if(!run_in_child(library, sample))
+        {
+            std::fprintf(stderr, "iteration %d failed\n", i);
+            return 1;
+        }
+        samples.push_back(sample);
+    }
+
+    std::printf("%s, %d processes\n", library, iters);
+    std::printf("%-8s %12s %12s %12s\n", "phase", "min_us", "median_us", "max_us");
+    for(int p = 0; p < phase_count; p++)
+    {
+        std::vector<double> us;
+        for(auto& sample : samples)
+            us.push_back(sample.us[p]);
+        std::sort(us.begin(), us.end());
+        std::printf(
+            "%-8s %12.1f %12.1f %12.1f\n", phase_names[p], us.front(), us[us.size() / 2], us.back());
+    }
+    std::printf("rocSOLVER mapped after load: %s, after first solver call: %s\n",
+                samples[0].solver_mapped_after_load ? "yes" : "no",
+                samples[0].solver_mapped_after_call ? "yes" : "no");
+
+    return 0;
+}
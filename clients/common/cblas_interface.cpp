@@ -103,6 +103,59 @@ void zgeqrf_(int*                  m,
              int*                  lwork,
              int*                  info);
 
+void sormqr_(char*  side,
+             char*  trans,
+             int*   m,
+             int*   n,
+             int*   k,
+             float* A,
+             int*   lda,
+             float* tau,
+             float* C,
+             int*   ldc,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dormqr_(char*   side,
+             char*   trans,
+             int*    m,
+             int*    n,
+             int*    k,
+             double* A,
+             int*    lda,
+             double* tau,
+             double* C,
+             int*    ldc,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cunmqr_(char*           side,
+             char*           trans,
+             int*            m,
+             int*            n,
+             int*            k,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* tau,
+             hipblasComplex* C,
+             int*            ldc,
+             hipblasComplex* work,
+             int*            lwork,
+             int*            info);
+void zunmqr_(char*                 side,
+             char*                 trans,
+             int*                  m,
+             int*                  n,
+             int*                  k,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* tau,
+             hipblasDoubleComplex* C,
+             int*                  ldc,
+             hipblasDoubleComplex* work,
+             int*                  lwork,
+             int*                  info);
+
 void sgels_(char*  trans,
             int*   m,
             int*   n,
@@ -153,6 +206,25 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
 void cspr_(
     char* uplo, int* n, hipblasComplex* alpha, hipblasComplex* x, int* incx, hipblasComplex* A);
 
@@ -1860,6 +1932,46 @@ int cblas_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(
+    char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char                  uplo,
+                int                   n,
+                int                   nrhs,
+                hipblasDoubleComplex* A,
+                int                   lda,
+                hipblasDoubleComplex* B,
+                int                   ldb)
+{
+    int info;
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
 // tbmv
 template <>
 void cblas_tbmv<float>(hipblasFillMode_t  uplo,
@@ -3948,6 +4060,83 @@ int cblas_geqrf<hipblasDoubleComplex>(int                   m,
     return info;
 }
 
+// ormqr and unmqr
+template <>
+int cblas_ormqr<float>(char   side,
+                       char   trans,
+                       int    m,
+                       int    n,
+                       int    k,
+                       float* A,
+                       int    lda,
+                       float* tau,
+                       float* C,
+                       int    ldc,
+                       float* work,
+                       int    lwork)
+{
+    int info;
+    sormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_ormqr<double>(char    side,
+                        char    trans,
+                        int     m,
+                        int     n,
+                        int     k,
+                        double* A,
+                        int     lda,
+                        double* tau,
+                        double* C,
+                        int     ldc,
+                        double* work,
+                        int     lwork)
+{
+    int info;
+    dormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_ormqr<hipblasComplex>(char            side,
+                                char            trans,
+                                int             m,
+                                int             n,
+                                int             k,
+                                hipblasComplex* A,
+                                int             lda,
+                                hipblasComplex* tau,
+                                hipblasComplex* C,
+                                int             ldc,
+                                hipblasComplex* work,
+                                int             lwork)
+{
+    int info;
+    cunmqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_ormqr<hipblasDoubleComplex>(char                  side,
+                                      char                  trans,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      hipblasDoubleComplex* A,
+                                      int                   lda,
+                                      hipblasDoubleComplex* tau,
+                                      hipblasDoubleComplex* C,
+                                      int                   ldc,
+                                      hipblasDoubleComplex* work,
+                                      int                   lwork)
+{
+    int info;
+    zunmqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+    return info;
+}
+
 // gels
 template <>
 int cblas_gels<float>(char   trans,
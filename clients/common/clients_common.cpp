@@ -90,6 +90,7 @@
 #include "blas2/testing_gbmv_strided_batched.hpp"
 #include "blas2/testing_gemv.hpp"
 #include "blas2/testing_gemv_batched.hpp"
+#include "blas2/testing_gemv_row_major.hpp"
 #include "blas2/testing_gemv_strided_batched.hpp"
 #include "blas2/testing_ger.hpp"
 #include "blas2/testing_ger_batched.hpp"
@@ -160,9 +161,11 @@
 #include "blas3/testing_dgmm_strided_batched.hpp"
 #include "blas3/testing_geam.hpp"
 #include "blas3/testing_geam_batched.hpp"
+#include "blas3/testing_geam_row_major.hpp"
 #include "blas3/testing_geam_strided_batched.hpp"
 #include "blas3/testing_gemm.hpp"
 #include "blas3/testing_gemm_batched.hpp"
+#include "blas3/testing_gemm_row_major.hpp"
 #include "blas3/testing_gemm_strided_batched.hpp"
 #include "blas3/testing_hemm.hpp"
 #include "blas3/testing_hemm_batched.hpp"
@@ -176,6 +179,12 @@
 #include "blas3/testing_herkx.hpp"
 #include "blas3/testing_herkx_batched.hpp"
 #include "blas3/testing_herkx_strided_batched.hpp"
+#include "blas3/testing_imatcopy.hpp"
+#include "blas3/testing_imatcopy_batched.hpp"
+#include "blas3/testing_imatcopy_strided_batched.hpp"
+#include "blas3/testing_omatcopy.hpp"
+#include "blas3/testing_omatcopy_batched.hpp"
+#include "blas3/testing_omatcopy_strided_batched.hpp"
 #include "blas3/testing_symm.hpp"
 #include "blas3/testing_symm_batched.hpp"
 #include "blas3/testing_symm_strided_batched.hpp"
@@ -184,6 +193,7 @@
 #include "blas3/testing_syr2k_strided_batched.hpp"
 #include "blas3/testing_syrk.hpp"
 #include "blas3/testing_syrk_batched.hpp"
+#include "blas3/testing_syrk_row_major.hpp"
 #include "blas3/testing_syrk_strided_batched.hpp"
 #include "blas3/testing_syrkx.hpp"
 #include "blas3/testing_syrkx_batched.hpp"
@@ -193,6 +203,7 @@
 #include "blas3/testing_trmm_strided_batched.hpp"
 #include "blas3/testing_trsm.hpp"
 #include "blas3/testing_trsm_batched.hpp"
+#include "blas3/testing_trsm_row_major.hpp"
 #include "blas3/testing_trsm_strided_batched.hpp"
 #include "blas3/testing_trtri.hpp"
 #include "blas3/testing_trtri_batched.hpp"
@@ -207,6 +218,8 @@
 #include "blas_ex/testing_dot_strided_batched_ex.hpp"
 #include "blas_ex/testing_gemm_batched_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_ex_with_epilogue.hpp"
+#include "blas_ex/testing_gemm_grouped_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_ex.hpp"
@@ -222,23 +235,37 @@
 #include "blas_ex/testing_trsm_strided_batched_ex.hpp"
 // solver functions
 #ifdef __HIP_PLATFORM_SOLVER__
+#include "solver/testing_dsgesv.hpp"
 #include "solver/testing_gels.hpp"
 #include "solver/testing_gels_batched.hpp"
 #include "solver/testing_gels_strided_batched.hpp"
 #include "solver/testing_geqrf.hpp"
 #include "solver/testing_geqrf_batched.hpp"
 #include "solver/testing_geqrf_strided_batched.hpp"
+#include "solver/testing_gesv_batched.hpp"
+#include "solver/testing_gesv_strided_batched.hpp"
 #include "solver/testing_getrf.hpp"
 #include "solver/testing_getrf_batched.hpp"
 #include "solver/testing_getrf_npvt.hpp"
 #include "solver/testing_getrf_npvt_batched.hpp"
 #include "solver/testing_getrf_npvt_strided_batched.hpp"
 #include "solver/testing_getrf_strided_batched.hpp"
+#include "solver/testing_getri.hpp"
 #include "solver/testing_getri_batched.hpp"
 #include "solver/testing_getri_npvt_batched.hpp"
+#include "solver/testing_getri_strided_batched.hpp"
 #include "solver/testing_getrs.hpp"
 #include "solver/testing_getrs_batched.hpp"
 #include "solver/testing_getrs_strided_batched.hpp"
+#include "solver/testing_ormqr.hpp"
+#include "solver/testing_ormqr_batched.hpp"
+#include "solver/testing_ormqr_strided_batched.hpp"
+#include "solver/testing_potrf.hpp"
+#include "solver/testing_potrf_batched.hpp"
+#include "solver/testing_potrf_strided_batched.hpp"
+#include "solver/testing_potrs.hpp"
+#include "solver/testing_potrs_batched.hpp"
+#include "solver/testing_potrs_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -341,6 +368,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemv", testname_gemv},
         {"gemv_batched", testname_gemv_batched},
         {"gemv_strided_batched", testname_gemv_strided_batched},
+        {"gemv_row_major", testname_gemv_row_major},
         {"ger", testname_ger},
         {"ger_batched", testname_ger_batched},
         {"ger_strided_batched", testname_ger_strided_batched},
@@ -418,11 +446,15 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"geam", testname_geam},
         {"geam_batched", testname_geam_batched},
         {"geam_strided_batched", testname_geam_strided_batched},
+        {"geam_row_major", testname_geam_row_major},
         {"gemm", testname_gemm},
         {"gemm_batched", testname_gemm_batched},
         {"gemm_strided_batched", testname_gemm_strided_batched},
+        {"gemm_row_major", testname_gemm_row_major},
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
+        {"gemm_ex_with_epilogue", testname_gemm_ex_with_epilogue},
+        {"gemm_grouped_ex", testname_gemm_grouped_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
@@ -436,12 +468,19 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"herkx", testname_herkx},
         {"herkx_batched", testname_herkx_batched},
         {"herkx_strided_batched", testname_herkx_strided_batched},
+        {"imatcopy", testname_imatcopy},
+        {"imatcopy_batched", testname_imatcopy_batched},
+        {"imatcopy_strided_batched", testname_imatcopy_strided_batched},
+        {"omatcopy", testname_omatcopy},
+        {"omatcopy_batched", testname_omatcopy_batched},
+        {"omatcopy_strided_batched", testname_omatcopy_strided_batched},
         {"symm", testname_symm},
         {"symm_batched", testname_symm_batched},
         {"symm_strided_batched", testname_symm_strided_batched},
         {"syrk", testname_syrk},
         {"syrk_batched", testname_syrk_batched},
         {"syrk_strided_batched", testname_syrk_strided_batched},
+        {"syrk_row_major", testname_syrk_row_major},
         {"syr2k", testname_syr2k},
         {"syr2k_batched", testname_syr2k_batched},
         {"syr2k_strided_batched", testname_syr2k_strided_batched},
@@ -454,6 +493,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"trsm", testname_trsm},
         {"trsm_batched", testname_trsm_batched},
         {"trsm_strided_batched", testname_trsm_strided_batched},
+        {"trsm_row_major", testname_trsm_row_major},
         {"trsm_ex", testname_trsm_ex},
         {"trsm_batched_ex", testname_trsm_batched_ex},
         {"trsm_strided_batched_ex", testname_trsm_strided_batched_ex},
@@ -471,14 +511,31 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"getrf_npvt", testname_getrf_npvt},
         {"getrf_npvt_batched", testname_getrf_npvt_batched},
         {"getrf_npvt_strided_batched", testname_getrf_npvt_strided_batched},
+        {"getri", testname_getri},
         {"getri_batched", testname_getri_batched},
         {"getri_npvt_batched", testname_getri_npvt_batched},
+        {"getri_strided_batched", testname_getri_strided_batched},
         {"getrs", testname_getrs},
         {"getrs_batched", testname_getrs_batched},
         {"getrs_strided_batched", testname_getrs_strided_batched},
+        {"dsgesv", testname_dsgesv},
+        {"gesv_batched", testname_gesv_batched},
+        {"gesv_strided_batched", testname_gesv_strided_batched},
         {"gels", testname_gels},
         {"gels_batched", testname_gels_batched},
         {"gels_strided_batched", testname_gels_strided_batched},
+        {"ormqr", testname_ormqr},
+        {"ormqr_batched", testname_ormqr_batched},
+        {"ormqr_strided_batched", testname_ormqr_strided_batched},
+        {"unmqr", testname_ormqr},
+        {"unmqr_batched", testname_ormqr_batched},
+        {"unmqr_strided_batched", testname_ormqr_strided_batched},
+        {"potrf", testname_potrf},
+        {"potrf_batched", testname_potrf_batched},
+        {"potrf_strided_batched", testname_potrf_strided_batched},
+        {"potrs", testname_potrs},
+        {"potrs_batched", testname_potrs_batched},
+        {"potrs_strided_batched", testname_potrs_strided_batched},
 #endif
 
         // Aux
@@ -514,6 +571,7 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex_ret<Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex_ret<Ti, To, Tc>},
+            {"gemm_grouped_ex", testing_gemm_grouped_ex_ret<Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -601,6 +659,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemv", testing_gemv_ret<T>},
             {"gemv_batched", testing_gemv_batched_ret<T>},
             {"gemv_strided_batched", testing_gemv_strided_batched_ret<T>},
+            {"gemv_row_major", testing_gemv_row_major_ret<T>},
             {"ger", testing_ger_ret<T, false>},
             {"ger_batched", testing_ger_batched_ret<T, false>},
             {"ger_strided_batched", testing_ger_strided_batched_ret<T, false>},
@@ -648,6 +707,13 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"geam", testing_geam_ret<T>},
             {"geam_batched", testing_geam_batched_ret<T>},
             {"geam_strided_batched", testing_geam_strided_batched_ret<T>},
+            {"geam_row_major", testing_geam_row_major_ret<T>},
+            {"omatcopy", testing_omatcopy_ret<T>},
+            {"omatcopy_batched", testing_omatcopy_batched_ret<T>},
+            {"omatcopy_strided_batched", testing_omatcopy_strided_batched_ret<T>},
+            {"imatcopy", testing_imatcopy_ret<T>},
+            {"imatcopy_batched", testing_imatcopy_batched_ret<T>},
+            {"imatcopy_strided_batched", testing_imatcopy_strided_batched_ret<T>},
             {"dgmm", testing_dgmm_ret<T>},
             {"dgmm_batched", testing_dgmm_batched_ret<T>},
             {"dgmm_strided_batched", testing_dgmm_strided_batched_ret<T>},
@@ -657,12 +723,14 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemm", testing_gemm_ret<T>},
             {"gemm_batched", testing_gemm_batched_ret<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched_ret<T>},
+            {"gemm_row_major", testing_gemm_row_major_ret<T>},
             {"symm", testing_symm_ret<T>},
             {"symm_batched", testing_symm_batched_ret<T>},
             {"symm_strided_batched", testing_symm_strided_batched_ret<T>},
             {"syrk", testing_syrk_ret<T>},
             {"syrk_batched", testing_syrk_batched_ret<T>},
             {"syrk_strided_batched", testing_syrk_strided_batched_ret<T>},
+            {"syrk_row_major", testing_syrk_row_major_ret<T>},
             {"syr2k", testing_syr2k_ret<T>},
             {"syr2k_batched", testing_syr2k_batched_ret<T>},
             {"syr2k_strided_batched", testing_syr2k_strided_batched_ret<T>},
@@ -677,7 +745,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"trsm_batched", testing_trsm_batched_ret<T>},
             {"trsm_batched_ex", testing_trsm_batched_ex_ret<T>},
             {"trsm_strided_batched", testing_trsm_strided_batched_ret<T>},
+            {"trsm_row_major", testing_trsm_row_major_ret<T>},
             {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex_ret<T>},
+            {"gemm_ex_with_epilogue", testing_gemm_ex_with_epilogue_ret<T>},
 
 #ifdef __HIP_PLATFORM_SOLVER__
             {"geqrf", testing_geqrf_ret<T>},
@@ -689,14 +759,28 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"getrf_npvt", testing_getrf_npvt_ret<T>},
             {"getrf_npvt_batched", testing_getrf_npvt_batched_ret<T>},
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched_ret<T>},
+            {"getri", testing_getri_ret<T>},
             {"getri_batched", testing_getri_batched_ret<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched_ret<T>},
+            {"getri_strided_batched", testing_getri_strided_batched_ret<T>},
             {"getrs", testing_getrs_ret<T>},
             {"getrs_batched", testing_getrs_batched_ret<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched_ret<T>},
+            {"dsgesv", testing_dsgesv_ret<T>},
+            {"gesv_batched", testing_gesv_batched_ret<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched_ret<T>},
             {"gels", testing_gels_ret<T>},
             {"gels_batched", testing_gels_batched_ret<T>},
             {"gels_strided_batched", testing_gels_strided_batched_ret<T>},
+            {"ormqr", testing_ormqr_ret<T>},
+            {"ormqr_batched", testing_ormqr_batched_ret<T>},
+            {"ormqr_strided_batched", testing_ormqr_strided_batched_ret<T>},
+            {"potrf", testing_potrf_ret<T>},
+            {"potrf_batched", testing_potrf_batched_ret<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched_ret<T>},
+            {"potrs", testing_potrs_ret<T>},
+            {"potrs_batched", testing_potrs_batched_ret<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched_ret<T>},
 #endif
 
             // Aux
@@ -793,6 +877,7 @@ struct perf_blas<
             {"gemv", testing_gemv_ret<T>},
             {"gemv_batched", testing_gemv_batched_ret<T>},
             {"gemv_strided_batched", testing_gemv_strided_batched_ret<T>},
+            {"gemv_row_major", testing_gemv_row_major_ret<T>},
             {"gbmv", testing_gbmv_ret<T>},
             {"gbmv_batched", testing_gbmv_batched_ret<T>},
             {"gbmv_strided_batched", testing_gbmv_strided_batched_ret<T>},
@@ -861,9 +946,17 @@ struct perf_blas<
             {"geam", testing_geam_ret<T>},
             {"geam_batched", testing_geam_batched_ret<T>},
             {"geam_strided_batched", testing_geam_strided_batched_ret<T>},
+            {"geam_row_major", testing_geam_row_major_ret<T>},
+            {"omatcopy", testing_omatcopy_ret<T>},
+            {"omatcopy_batched", testing_omatcopy_batched_ret<T>},
+            {"omatcopy_strided_batched", testing_omatcopy_strided_batched_ret<T>},
+            {"imatcopy", testing_imatcopy_ret<T>},
+            {"imatcopy_batched", testing_imatcopy_batched_ret<T>},
+            {"imatcopy_strided_batched", testing_imatcopy_strided_batched_ret<T>},
             {"gemm", testing_gemm_ret<T>},
             {"gemm_batched", testing_gemm_batched_ret<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched_ret<T>},
+            {"gemm_row_major", testing_gemm_row_major_ret<T>},
             {"hemm", testing_hemm_ret<T>},
             {"hemm_batched", testing_hemm_batched_ret<T>},
             {"hemm_strided_batched", testing_hemm_strided_batched_ret<T>},
@@ -882,6 +975,7 @@ struct perf_blas<
             {"syrk", testing_syrk_ret<T>},
             {"syrk_batched", testing_syrk_batched_ret<T>},
             {"syrk_strided_batched", testing_syrk_strided_batched_ret<T>},
+            {"syrk_row_major", testing_syrk_row_major_ret<T>},
             {"syr2k", testing_syr2k_ret<T>},
             {"syr2k_batched", testing_syr2k_batched_ret<T>},
             {"syr2k_strided_batched", testing_syr2k_strided_batched_ret<T>},
@@ -894,6 +988,7 @@ struct perf_blas<
             {"trsm", testing_trsm_ret<T>},
             {"trsm_batched", testing_trsm_batched_ret<T>},
             {"trsm_strided_batched", testing_trsm_strided_batched_ret<T>},
+            {"trsm_row_major", testing_trsm_row_major_ret<T>},
             {"trsm_ex", testing_trsm_ex_ret<T>},
             {"trsm_batched_ex", testing_trsm_batched_ex_ret<T>},
             {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex_ret<T>},
@@ -911,14 +1006,27 @@ struct perf_blas<
             {"getrf_npvt", testing_getrf_npvt_ret<T>},
             {"getrf_npvt_batched", testing_getrf_npvt_batched_ret<T>},
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched_ret<T>},
+            {"getri", testing_getri_ret<T>},
             {"getri_batched", testing_getri_batched_ret<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched_ret<T>},
+            {"getri_strided_batched", testing_getri_strided_batched_ret<T>},
             {"getrs", testing_getrs_ret<T>},
             {"getrs_batched", testing_getrs_batched_ret<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched_ret<T>},
+            {"gesv_batched", testing_gesv_batched_ret<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched_ret<T>},
             {"gels", testing_gels_ret<T>},
             {"gels_batched", testing_gels_batched_ret<T>},
             {"gels_strided_batched", testing_gels_strided_batched_ret<T>},
+            {"unmqr", testing_ormqr_ret<T>},
+            {"unmqr_batched", testing_ormqr_batched_ret<T>},
+            {"unmqr_strided_batched", testing_ormqr_strided_batched_ret<T>},
+            {"potrf", testing_potrf_ret<T>},
+            {"potrf_batched", testing_potrf_batched_ret<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched_ret<T>},
+            {"potrs", testing_potrs_ret<T>},
+            {"potrs_batched", testing_potrs_batched_ret<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched_ret<T>},
 #endif
         };
         run_function(map, arg);
@@ -1284,7 +1392,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_grouped_ex"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
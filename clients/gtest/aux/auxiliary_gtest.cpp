@@ -23,8 +23,12 @@
 
 #include "testing_exceptions.hpp"
 #include "utility.h"
+#include <cstdlib>
+#include <fstream>
 #include <math.h>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace
@@ -47,4 +51,820 @@ namespace
         EXPECT_EQ(testing_handle(), HIPBLAS_STATUS_SUCCESS);
     }
 
+    TEST(hipblas_auxiliary, handleStatistics)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        int count = 0;
+        EXPECT_EQ(hipblasGetHandleStatistics(nullptr, &count, nullptr),
+                  HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+        EXPECT_EQ(hipblasGetHandleStatistics(handle, nullptr, nullptr),
+                  HIPBLAS_STATUS_INVALID_VALUE);
+
+        // Statistics are only collected with HIPBLAS_LAYER=4, but are always empty after a reset
+        EXPECT_EQ(hipblasResetHandleStatistics(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasGetHandleStatistics(handle, &count, nullptr), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(count, 0);
+
+        hipblasFunctionStatistics statistics[1];
+        count = 1;
+        EXPECT_EQ(hipblasGetHandleStatistics(handle, &count, statistics), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(count, 0);
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    // Sets or, if value is nullptr, removes an environment variable
+    void set_environment(const char* name, const char* value)
+    {
+#ifdef WIN32
+        _putenv_s(name, value ? value : "");
+#else
+        if(value)
+            setenv(name, value, 1);
+        else
+            unsetenv(name);
+#endif
+    }
+
+    TEST(hipblas_auxiliary, handleStatisticsCollected)
+    {
+        // Statistics are enabled for the whole process by a handle created with HIPBLAS_LAYER=4
+        const char*     layer    = getenv("HIPBLAS_LAYER");
+        std::string     previous = layer ? layer : "";
+        hipblasHandle_t handle;
+        set_environment("HIPBLAS_LAYER", "4");
+        hipblasStatus_t status = hipblasCreate(&handle);
+        set_environment("HIPBLAS_LAYER", layer ? previous.c_str() : nullptr);
+        ASSERT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+        const int            n = 16, gemv_calls = 3, gemm_calls = 2;
+        const float          alpha = 1.0f, beta = 0.0f;
+        std::vector<float>   hA(n * n, 1.0f);
+        device_vector<float> dA(n * n), dB(n * n), dC(n * n);
+        ASSERT_EQ(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        ASSERT_EQ(hipMemcpy(dB, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+
+        for(int i = 0; i < gemv_calls; i++)
+            ASSERT_EQ(hipblasSgemv(handle, HIPBLAS_OP_N, n, n, &alpha, dA, n, dB, 1, &beta, dC, 1),
+                      HIPBLAS_STATUS_SUCCESS);
+        for(int i = 0; i < gemm_calls; i++)
+            ASSERT_EQ(hipblasSgemm(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   n,
+                                   n,
+                                   n,
+                                   &alpha,
+                                   dA,
+                                   n,
+                                   dB,
+                                   n,
+                                   &beta,
+                                   dC,
+                                   n),
+                      HIPBLAS_STATUS_SUCCESS);
+
+        int count = 0;
+        ASSERT_EQ(hipblasGetHandleStatistics(handle, &count, nullptr), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(count, 2);
+        std::vector<hipblasFunctionStatistics> statistics(count);
+        ASSERT_EQ(hipblasGetHandleStatistics(handle, &count, statistics.data()),
+                  HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(count, 2);
+
+        bool gemv_found = false, gemm_found = false;
+        for(const hipblasFunctionStatistics& entry : statistics)
+        {
+            std::string function = entry.function;
+            if(function == "hipblasSgemv")
+            {
+                gemv_found = true;
+                EXPECT_EQ(entry.callCount, uint64_t(gemv_calls));
+            }
+            else if(function == "hipblasSgemm")
+            {
+                gemm_found = true;
+                EXPECT_EQ(entry.callCount, uint64_t(gemm_calls));
+                EXPECT_EQ(entry.flops, 2.0 * n * n * n * gemm_calls);
+            }
+            EXPECT_GT(entry.flops, 0);
+            EXPECT_GT(entry.bytes, 0);
+            EXPECT_GE(entry.totalTimeUs, 0);
+
+            uint64_t histogram_total = 0;
+            for(uint64_t bucket : entry.latencyHistogram)
+                histogram_total += bucket;
+            EXPECT_EQ(histogram_total, entry.callCount);
+        }
+        EXPECT_TRUE(gemv_found);
+        EXPECT_TRUE(gemm_found);
+
+        // Calls made with other handles are counted separately
+        hipblasHandle_t other;
+        ASSERT_EQ(hipblasCreate(&other), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipblasGetHandleStatistics(other, &count, nullptr), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(count, 0);
+        EXPECT_EQ(hipblasDestroy(other), HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_EQ(hipblasResetHandleStatistics(handle), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipblasGetHandleStatistics(handle, &count, nullptr), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(count, 0);
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, deferredBatching)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_EQ(hipblasBeginDeferredBatching(nullptr, 0), HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+        EXPECT_EQ(hipblasFlushDeferredBatching(nullptr), HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+        EXPECT_EQ(hipblasBeginDeferredBatching(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+
+        // Flushing a handle that is not deferring does nothing
+        EXPECT_EQ(hipblasFlushDeferredBatching(handle), HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_EQ(hipblasBeginDeferredBatching(handle, 0), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasFlushDeferredBatching(handle), HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_EQ(hipblasEndDeferredBatching(nullptr), HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+        EXPECT_EQ(hipblasEndDeferredBatching(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasEndDeferredBatching(handle), HIPBLAS_STATUS_SUCCESS);
+
+        // Destroying a deferring handle ends deferred batching
+        EXPECT_EQ(hipblasBeginDeferredBatching(handle, 4), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, deferredBatchingResults)
+    {
+#ifdef HIPBLAS_USE_HOST
+        GTEST_SKIP() << "The host backend issues calls immediately";
+#endif
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        // Matrices A[i] hold i + 1 and B holds 1, so C[i] = A[i] * B holds n * (i + 1)
+        const int            n = 4, batch = 3, size = n * n;
+        const float          alpha = 1.0f, beta = 0.0f, unset = -1.0f;
+        std::vector<float>   hA(size * batch), hB(size, 1.0f), hC(size * batch, unset);
+        std::vector<float>   hD(size, unset), result(size * batch);
+        device_vector<float> dA(size * batch), dB(size), dC(size * batch), dD(size);
+        for(int i = 0; i < size * batch; i++)
+            hA[i] = float(i / size + 1);
+        ASSERT_EQ(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        ASSERT_EQ(hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        ASSERT_EQ(hipMemcpy(dC, hC.data(), hC.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        ASSERT_EQ(hipMemcpy(dD, hD.data(), hD.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+
+        auto sgemm = [&](const float* A, float* C) {
+            return hipblasSgemm(
+                handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, A, n, dB, n, &beta, C, n);
+        };
+        auto gemm_ex = [&](const float* A, float* C) {
+            return hipblasGemmEx_v2(handle,
+                                    HIPBLAS_OP_N,
+                                    HIPBLAS_OP_N,
+                                    n,
+                                    n,
+                                    n,
+                                    &alpha,
+                                    A,
+                                    HIP_R_32F,
+                                    n,
+                                    dB,
+                                    HIP_R_32F,
+                                    n,
+                                    &beta,
+                                    C,
+                                    HIP_R_32F,
+                                    n,
+                                    HIPBLAS_COMPUTE_32F,
+                                    HIPBLAS_GEMM_DEFAULT);
+        };
+        // hipMemcpy is not a hipBLAS function, so it reads C without issuing collected calls
+        auto read = [&](const float* d, int count) {
+            EXPECT_EQ(hipMemcpy(result.data(), d, count * sizeof(float), hipMemcpyDeviceToHost),
+                      hipSuccess);
+        };
+        auto expect_values = [&](int first, int count, auto value) {
+            for(int i = first; i < first + count; i++)
+                EXPECT_EQ(result[i], value(i)) << "at " << i;
+        };
+        auto product   = [&](int i) { return float(n * (i / size + 1)); };
+        auto unchanged = [&](int) { return unset; };
+
+        ASSERT_EQ(hipblasBeginDeferredBatching(handle, 0), HIPBLAS_STATUS_SUCCESS);
+
+        // Independent calls are collected and not issued before the flush
+        ASSERT_EQ(sgemm(dA, dC), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(sgemm(dA + size, dC + size), HIPBLAS_STATUS_SUCCESS);
+        read(dC, size * batch);
+        expect_values(0, size, unchanged);
+        ASSERT_EQ(hipblasFlushDeferredBatching(handle), HIPBLAS_STATUS_SUCCESS);
+        read(dC, size * batch);
+        expect_values(0, 2 * size, product);
+        expect_values(2 * size, size, unchanged);
+
+        // Deferred batching stays enabled after a flush, and collects hipblasGemmEx calls too
+        ASSERT_EQ(gemm_ex(dA + 2 * size, dC + 2 * size), HIPBLAS_STATUS_SUCCESS);
+        read(dC, size * batch);
+        expect_values(2 * size, size, unchanged);
+
+        // A call reading a collected C issues the collected calls first
+        ASSERT_EQ(gemm_ex(dC + 2 * size, dD), HIPBLAS_STATUS_SUCCESS);
+        read(dC, size * batch);
+        expect_values(0, size * batch, product);
+        read(dD, size);
+        expect_values(0, size, unchanged);
+
+        ASSERT_EQ(hipblasEndDeferredBatching(handle), HIPBLAS_STATUS_SUCCESS);
+        read(dD, size);
+        expect_values(0, size, [&](int) { return float(n * n * batch); });
+
+        // After deferred batching ends calls are issued immediately
+        ASSERT_EQ(sgemm(dA, dD), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        read(dD, size);
+        expect_values(0, size, product);
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    struct allocatorCounts
+    {
+        int allocs = 0;
+        int frees  = 0;
+    };
+
+    void* countingMalloc(void* userData, size_t size, hipStream_t)
+    {
+        void* ptr = nullptr;
+        if(hipMalloc(&ptr, size) != hipSuccess)
+            return nullptr;
+        static_cast<allocatorCounts*>(userData)->allocs++;
+        return ptr;
+    }
+
+    void countingFree(void* userData, void* ptr, hipStream_t stream)
+    {
+        (void)hipStreamSynchronize(stream);
+        (void)hipFree(ptr);
+        static_cast<allocatorCounts*>(userData)->frees++;
+    }
+
+    TEST(hipblas_auxiliary, shapeHistogram)
+    {
+        EXPECT_EQ(hipblasWriteShapeHistogram(nullptr, -1), HIPBLAS_STATUS_INVALID_VALUE);
+
+        // Shapes are only counted with HIPBLAS_LAYER bit 8 set when hipBLAS is loaded
+        const char* layer  = getenv("HIPBLAS_LAYER");
+        bool        shapes = layer && (strtoul(layer, nullptr, 0) & 8);
+        std::string path   = hipblas_tempname();
+        if(!shapes)
+        {
+            EXPECT_EQ(hipblasWriteShapeHistogram(path.c_str(), 1), HIPBLAS_STATUS_NOT_SUPPORTED);
+            return;
+        }
+
+        ASSERT_EQ(hipblasWriteShapeHistogram(path.c_str(), 1), HIPBLAS_STATUS_SUCCESS);
+        std::ifstream file(path);
+        std::string   contents((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+        EXPECT_NE(contents.find("Tests:"), std::string::npos);
+        remove(path.c_str());
+    }
+
+    struct callbackCounts
+    {
+        int         preCalls  = 0;
+        int         postCalls = 0;
+        const char* function  = nullptr;
+        std::string argNames;
+        int64_t     m = 0;
+    };
+
+    void countingPreCall(void* userData, const hipblasCallInfo* info)
+    {
+        auto* counts     = static_cast<callbackCounts*>(userData);
+        counts->function = info->function;
+        counts->argNames = info->argNames;
+        counts->m        = info->numArgs > 2 ? info->args[2] : 0;
+        counts->preCalls++;
+    }
+
+    void countingPostCall(void* userData, const hipblasCallInfo* info)
+    {
+        static_cast<callbackCounts*>(userData)->postCalls++;
+    }
+
+    TEST(hipblas_auxiliary, setCallbacks)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        const int            m = 48, n = 32, k = 16;
+        device_vector<float> dA(m * k), dB(k * n), dC(m * n);
+        const float          alpha = 1.0f, beta = 0.0f;
+
+        callbackCounts counts;
+        ASSERT_EQ(hipblasSetCallbacks(countingPreCall, countingPostCall, &counts),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(
+            hipblasSgemm(
+                handle, HIPBLAS_OP_N, HIPBLAS_OP_N, m, n, k, &alpha, dA, m, dB, k, &beta, dC, m),
+            HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(counts.preCalls, 1);
+        EXPECT_EQ(counts.postCalls, 1);
+        EXPECT_STREQ(counts.function, "hipblasSgemm");
+        EXPECT_EQ(counts.argNames, "transA,transB,m,n,k,lda,ldb,ldc");
+        EXPECT_EQ(counts.m, m);
+
+        // No calls are reported once the callbacks are removed
+        ASSERT_EQ(hipblasSetCallbacks(nullptr, nullptr, nullptr), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(
+            hipblasSgemm(
+                handle, HIPBLAS_OP_N, HIPBLAS_OP_N, m, n, k, &alpha, dA, m, dB, k, &beta, dC, m),
+            HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(counts.preCalls, 1);
+        EXPECT_EQ(counts.postCalls, 1);
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, setAllocator)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        allocatorCounts counts;
+        EXPECT_EQ(hipblasSetAllocator(nullptr, countingMalloc, countingFree, &counts),
+                  HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_EQ(hipblasSetAllocator(handle, countingMalloc, nullptr, &counts),
+                  HIPBLAS_STATUS_INVALID_VALUE);
+
+        hipblasStatus_t status = hipblasSetAllocator(handle, countingMalloc, countingFree, &counts);
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+        // The handle still works with the workspace drawn from the callbacks
+        const int            n = 64;
+        device_vector<float> dA(n * n), dB(n * n), dC(n * n);
+        const float          alpha = 1.0f, beta = 0.0f;
+        status = hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, n, dB, n, &beta, dC, n);
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+        // Returning to library allocation frees the workspace
+        EXPECT_EQ(hipblasSetAllocator(handle, nullptr, nullptr, nullptr), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(counts.allocs, counts.frees);
+
+        EXPECT_EQ(hipblasSetAllocator(handle, countingMalloc, countingFree, &counts),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(counts.allocs, counts.frees);
+    }
+
+    TEST(hipblas_auxiliary, planWorkspace)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        hipblasPlannedCall trsm = {};
+        trsm.function           = "hipblasStrsmStridedBatched";
+        trsm.side               = HIPBLAS_SIDE_LEFT;
+        trsm.uplo               = HIPBLAS_FILL_MODE_LOWER;
+        trsm.trans              = HIPBLAS_OP_N;
+        trsm.diag               = HIPBLAS_DIAG_NON_UNIT;
+        trsm.m                  = 256;
+        trsm.n                  = 256;
+        trsm.lda                = 256;
+        trsm.ldb                = 256;
+        trsm.batchCount         = 8;
+
+        hipblasPlannedCall trsv = trsm;
+        trsv.function           = "hipblasDtrsv";
+
+        const hipblasPlannedCall calls[] = {trsm, trsv};
+
+        size_t size = 1;
+        EXPECT_EQ(hipblasPlanWorkspace(nullptr, 2, calls, &size, 0),
+                  HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_EQ(hipblasPlanWorkspace(handle, 2, calls, nullptr, 0), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_EQ(hipblasPlanWorkspace(handle, 0, nullptr, &size, 0), HIPBLAS_STATUS_SUCCESS);
+
+        // Count workspace allocations where the backend takes an allocator
+        allocatorCounts counts;
+        hipblasStatus_t status = hipblasSetAllocator(handle, countingMalloc, countingFree, &counts);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_EQ(hipblasPlanWorkspace(handle, 2, calls, &size, 1), HIPBLAS_STATUS_SUCCESS);
+#if !defined(HIPBLAS_USE_HOST) && !defined(__HIP_PLATFORM_NVCC__)
+        EXPECT_GT(size, 0);
+#else
+        EXPECT_EQ(size, 0);
+#endif
+
+        // Planning does not change how the handle is used
+        hipblasPointerMode_t mode;
+        EXPECT_EQ(hipblasGetPointerMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(mode, HIPBLAS_POINTER_MODE_HOST);
+
+        // A planned call runs in the reserved workspace without allocating again
+        const int            n = 256, batchCount = 8;
+        const hipblasStride  stride = n * n;
+        device_vector<float> dA(stride * batchCount), dB(stride * batchCount);
+        const float          alpha  = 1.0f;
+        const int            allocs = counts.allocs;
+        EXPECT_EQ(hipblasStrsmStridedBatched(handle,
+                                             HIPBLAS_SIDE_LEFT,
+                                             HIPBLAS_FILL_MODE_LOWER,
+                                             HIPBLAS_OP_N,
+                                             HIPBLAS_DIAG_NON_UNIT,
+                                             n,
+                                             n,
+                                             &alpha,
+                                             dA,
+                                             n,
+                                             stride,
+                                             dB,
+                                             n,
+                                             stride,
+                                             batchCount),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(counts.allocs, allocs);
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(counts.allocs, counts.frees);
+    }
+
+#if !defined(HIPBLAS_USE_HOST) && !defined(__HIP_PLATFORM_NVCC__)
+    // Runs a tuned hipblasGemmEx twice, returning 0 if both results match hipblasSgemm, which is
+    // not tuned. Small integers make every sum exact, whichever solution is used.
+    int run_tuned_gemm_ex()
+    {
+        hipblasHandle_t handle;
+        if(hipblasCreate(&handle) != HIPBLAS_STATUS_SUCCESS)
+            return 1;
+
+        const int            m = 96, n = 80, k = 64;
+        const float          alpha = 1.0f, beta = 0.0f;
+        std::vector<float>   hA(m * k), hB(k * n), hC(m * n), hD(m * n);
+        device_vector<float> dA(m * k), dB(k * n), dC(m * n), dD(m * n);
+        for(size_t i = 0; i < hA.size(); i++)
+            hA[i] = float(int(i % 7) - 3);
+        for(size_t i = 0; i < hB.size(); i++)
+            hB[i] = float(int(i % 5) - 2);
+        bool ok = hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice)
+                      == hipSuccess
+                  && hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice)
+                         == hipSuccess
+                  && hipblasSgemm(handle,
+                                  HIPBLAS_OP_N,
+                                  HIPBLAS_OP_N,
+                                  m,
+                                  n,
+                                  k,
+                                  &alpha,
+                                  dA,
+                                  m,
+                                  dB,
+                                  k,
+                                  &beta,
+                                  dC,
+                                  m)
+                         == HIPBLAS_STATUS_SUCCESS
+                  && hipMemcpy(hC.data(), dC, hC.size() * sizeof(float), hipMemcpyDeviceToHost)
+                         == hipSuccess;
+
+        // The first call tunes and records the shape, the second uses the recorded solution
+        for(int call = 0; ok && call < 2; call++)
+            ok = hipMemset(dD, 0, hD.size() * sizeof(float)) == hipSuccess
+                 && hipblasGemmEx_v2(handle,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_OP_N,
+                                     m,
+                                     n,
+                                     k,
+                                     &alpha,
+                                     dA,
+                                     HIP_R_32F,
+                                     m,
+                                     dB,
+                                     HIP_R_32F,
+                                     k,
+                                     &beta,
+                                     dD,
+                                     HIP_R_32F,
+                                     m,
+                                     HIPBLAS_COMPUTE_32F,
+                                     HIPBLAS_GEMM_DEFAULT)
+                        == HIPBLAS_STATUS_SUCCESS
+                 && hipMemcpy(hD.data(), dD, hD.size() * sizeof(float), hipMemcpyDeviceToHost)
+                        == hipSuccess
+                 && hD == hC;
+
+        ok = hipblasDestroy(handle) == HIPBLAS_STATUS_SUCCESS && ok;
+        return ok ? 0 : 1;
+    }
+#endif
+
+    TEST(hipblas_auxiliary, gemmTuningDatabase)
+    {
+#if defined(HIPBLAS_USE_HOST) || defined(__HIP_PLATFORM_NVCC__)
+        GTEST_SKIP() << "Only the rocBLAS backend tunes gemm_ex";
+#else
+        // The tuning variables are read once for the process, so the tuned calls run in a new
+        // process started with them set
+        const char* tuning          = getenv("HIPBLAS_GEMM_TUNING");
+        const char* database        = getenv("HIPBLAS_GEMM_TUNING_DB");
+        std::string previous_tuning = tuning ? tuning : "";
+        std::string previous_db     = database ? database : "";
+        std::string path            = hipblas_tempname();
+        set_environment("HIPBLAS_GEMM_TUNING", "1");
+        set_environment("HIPBLAS_GEMM_TUNING_DB", path.c_str());
+
+        ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+        EXPECT_EXIT(std::exit(run_tuned_gemm_ex()), ::testing::ExitedWithCode(0), "");
+
+        set_environment("HIPBLAS_GEMM_TUNING", tuning ? previous_tuning.c_str() : nullptr);
+        set_environment("HIPBLAS_GEMM_TUNING_DB", database ? previous_db.c_str() : nullptr);
+
+        // Only the first call tunes, adding one line for the shape
+        std::ifstream file(path);
+        std::string   line;
+        int           lines = 0;
+        while(std::getline(file, line))
+            lines++;
+        EXPECT_EQ(lines, 1);
+        remove(path.c_str());
+#endif
+    }
+
+    TEST(hipblas_auxiliary, handlePool)
+    {
+        hipblasHandle_t handle, again;
+        EXPECT_EQ(hipblasAcquireHandle(nullptr, -1, nullptr), HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+        EXPECT_EQ(hipblasAcquireHandle(&handle, -2, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+        hipStream_t stream;
+        ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+        ASSERT_EQ(hipblasAcquireHandle(&handle, -1, stream), HIPBLAS_STATUS_SUCCESS);
+
+        hipStream_t handle_stream;
+        EXPECT_EQ(hipblasGetStream(handle, &handle_stream), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(handle_stream, stream);
+        EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE),
+                  HIPBLAS_STATUS_SUCCESS);
+
+        hipblasAtomicsMode_t atomics;
+        EXPECT_EQ(hipblasGetAtomicsMode(handle, &atomics), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(atomics, HIPBLAS_ATOMICS_ALLOWED);
+        EXPECT_EQ(hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_NOT_ALLOWED),
+                  HIPBLAS_STATUS_SUCCESS);
+
+        // A released handle is reused, with its pointer and atomics modes reset
+        EXPECT_EQ(hipblasReleaseHandle(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasReleaseHandle(handle), HIPBLAS_STATUS_INVALID_VALUE);
+        ASSERT_EQ(hipblasAcquireHandle(&again, -1, nullptr), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(again, handle);
+
+        hipblasPointerMode_t mode;
+        EXPECT_EQ(hipblasGetPointerMode(again, &mode), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(mode, HIPBLAS_POINTER_MODE_HOST);
+        EXPECT_EQ(hipblasGetAtomicsMode(again, &atomics), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(atomics, HIPBLAS_ATOMICS_ALLOWED);
+        EXPECT_EQ(hipblasReleaseHandle(again), HIPBLAS_STATUS_SUCCESS);
+
+        // A thread keeps its handle, which returns to the pool when the thread exits
+        hipblasHandle_t thread_handle = nullptr;
+        std::thread([&]() {
+            hipblasHandle_t first, second;
+            EXPECT_EQ(hipblasGetThreadHandle(&first, stream), HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(hipblasGetThreadHandle(&second, nullptr), HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(first, second);
+            EXPECT_EQ(hipblasReleaseHandle(first), HIPBLAS_STATUS_INVALID_VALUE);
+            thread_handle = first;
+        }).join();
+        ASSERT_EQ(hipblasAcquireHandle(&again, -1, nullptr), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(again, thread_handle);
+        EXPECT_EQ(hipblasReleaseHandle(again), HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_EQ(hipblasClearHandlePool(), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+    }
+
+    TEST(hipblas_auxiliary, stridedPointerArray)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        const int            n = 16, batch_count = 8;
+        device_vector<float> dA(n * n * batch_count), dC(n * n * batch_count);
+        const int64_t        stride_bytes = n * n * sizeof(float);
+
+        void** array = nullptr;
+        EXPECT_EQ(hipblasGetStridedPointerArray(nullptr, dA, stride_bytes, batch_count, &array),
+                  HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+        EXPECT_EQ(hipblasGetStridedPointerArray(handle, dA, stride_bytes, -1, &array),
+                  HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_EQ(hipblasGetStridedPointerArray(handle, dA, stride_bytes, 0, &array),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(array, nullptr);
+
+        ASSERT_EQ(hipblasGetStridedPointerArray(handle, dA, stride_bytes, batch_count, &array),
+                  HIPBLAS_STATUS_SUCCESS);
+        std::vector<float*> pointers(batch_count);
+        ASSERT_EQ(hipMemcpy(pointers.data(),
+                            array,
+                            batch_count * sizeof(float*),
+                            hipMemcpyDeviceToHost),
+                  hipSuccess);
+        for(int i = 0; i < batch_count; i++)
+            EXPECT_EQ(pointers[i], (float*)dA + i * n * n);
+
+        // The same arguments return the same array, and different ones another array
+        void** again = nullptr;
+        EXPECT_EQ(hipblasGetStridedPointerArray(handle, dA, stride_bytes, batch_count, &again),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(again, array);
+        EXPECT_EQ(hipblasGetStridedPointerArray(handle, dA, stride_bytes, batch_count - 1, &again),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_NE(again, array);
+
+        // The arrays work with a batched function, which computes with the strided form
+        std::vector<float> hA(n * n * batch_count, 1.0f), hC(n * n * batch_count);
+        ASSERT_EQ(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        void** c_array = nullptr;
+        ASSERT_EQ(hipblasGetStridedPointerArray(handle, dC, stride_bytes, batch_count, &c_array),
+                  HIPBLAS_STATUS_SUCCESS);
+        const float alpha = 1.0f, beta = 0.0f;
+        EXPECT_EQ(hipblasSgemmBatched(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      n,
+                                      n,
+                                      n,
+                                      &alpha,
+                                      (const float* const*)array,
+                                      n,
+                                      (const float* const*)array,
+                                      n,
+                                      &beta,
+                                      (float* const*)c_array,
+                                      n,
+                                      batch_count),
+                  HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipMemcpy(hC.data(), dC, hC.size() * sizeof(float), hipMemcpyDeviceToHost),
+                  hipSuccess);
+        for(float c : hC)
+            EXPECT_EQ(c, float(n));
+
+        EXPECT_EQ(hipblasClearPointerArrays(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, rowMajor)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        // Row-major A is 3 x 2, B is 2 x 4 and C is 3 x 4, with no padding between rows
+        const int          m = 3, n = 4, k = 2;
+        std::vector<float> hA = {1, 2, 3, 4, 5, 6};
+        std::vector<float> hB = {1, 0, 2, 1, 0, 1, 1, 3};
+        std::vector<float> hC(m * n), expected(m * n, 0.0f);
+        for(int i = 0; i < m; i++)
+            for(int j = 0; j < n; j++)
+                for(int l = 0; l < k; l++)
+                    expected[i * n + j] += hA[i * k + l] * hB[l * n + j];
+
+        device_vector<float> dA(m * k), dB(k * n), dC(m * n);
+        ASSERT_EQ(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        ASSERT_EQ(hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+
+        const float alpha = 1.0f, beta = 0.0f;
+        hipblasStatus_t status = hipblasSgemmRowMajor(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, m, n, k, &alpha, dA, k, dB, n, &beta, dC, n);
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipMemcpy(hC.data(), dC, hC.size() * sizeof(float), hipMemcpyDeviceToHost),
+                  hipSuccess);
+        for(int i = 0; i < m * n; i++)
+            EXPECT_EQ(hC[i], expected[i]);
+
+        // y = B * x, for B as a 2 x 4 row-major matrix
+        std::vector<float>   hx = {1, 2, 3, 4}, hy(k);
+        device_vector<float> dx(n), dy(k);
+        ASSERT_EQ(hipMemcpy(dx, hx.data(), hx.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        status
+            = hipblasSgemvRowMajor(handle, HIPBLAS_OP_N, k, n, &alpha, dB, n, dx, 1, &beta, dy, 1);
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipMemcpy(hy.data(), dy, hy.size() * sizeof(float), hipMemcpyDeviceToHost),
+                  hipSuccess);
+        EXPECT_EQ(hy[0], 1 * 1 + 0 * 2 + 2 * 3 + 1 * 4);
+        EXPECT_EQ(hy[1], 0 * 1 + 1 * 2 + 1 * 3 + 3 * 4);
+
+        // Solving with the lower triangle of a row-major 2 x 2 matrix recovers B from L * B
+        std::vector<float> hL = {2, 0, 1, 4}, hX(k * n);
+        for(int j = 0; j < n; j++)
+        {
+            hX[j]     = hL[0] * hB[j];
+            hX[n + j] = hL[2] * hB[j] + hL[3] * hB[n + j];
+        }
+        device_vector<float> dL(k * k), dX(k * n);
+        ASSERT_EQ(hipMemcpy(dL, hL.data(), hL.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        ASSERT_EQ(hipMemcpy(dX, hX.data(), hX.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        EXPECT_EQ(hipblasStrsmRowMajor(handle,
+                                       HIPBLAS_SIDE_LEFT,
+                                       HIPBLAS_FILL_MODE_LOWER,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_DIAG_NON_UNIT,
+                                       k,
+                                       n,
+                                       &alpha,
+                                       dL,
+                                       k,
+                                       dX,
+                                       n),
+                  HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipMemcpy(hX.data(), dX, hX.size() * sizeof(float), hipMemcpyDeviceToHost),
+                  hipSuccess);
+        for(int i = 0; i < k * n; i++)
+            EXPECT_NEAR(hX[i], hB[i], 1e-5);
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, matcopy)
+    {
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+        // A is 3 x 5 and is transposed in place to 5 x 3, so lda = 3 becomes ldb = 5
+        const int          rows = 3, cols = 5, batch = 2;
+        std::vector<float> hA(rows * cols * batch), hB(hA.size()), expected(hA.size());
+        for(size_t i = 0; i < hA.size(); i++)
+            hA[i] = float(i);
+        for(int b = 0; b < batch; b++)
+        {
+            const int offset = b * rows * cols;
+            for(int i = 0; i < rows; i++)
+                for(int j = 0; j < cols; j++)
+                    expected[offset + j + i * cols] = 2 * hA[offset + i + j * rows];
+        }
+
+        const size_t         size = hA.size() * sizeof(float);
+        device_vector<float> dA(hA.size()), dB(hA.size());
+        ASSERT_EQ(hipMemcpy(dA, hA.data(), size, hipMemcpyHostToDevice), hipSuccess);
+
+        const float     alpha  = 2.0f;
+        hipblasStatus_t status = hipblasSomatcopy(
+            handle, HIPBLAS_OP_T, rows, cols, &alpha, dA, rows, dB, cols);
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipMemcpy(hB.data(), dB, size / batch, hipMemcpyDeviceToHost), hipSuccess);
+        for(int i = 0; i < rows * cols; i++)
+            EXPECT_EQ(hB[i], expected[i]);
+
+        status = hipblasSimatcopy(handle, HIPBLAS_OP_T, rows, cols, &alpha, dA, rows, cols);
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipMemcpy(hB.data(), dA, size / batch, hipMemcpyDeviceToHost), hipSuccess);
+        for(int i = 0; i < rows * cols; i++)
+            EXPECT_EQ(hB[i], expected[i]);
+
+        // The strided-batched form is computed by geamStridedBatched, which not every backend
+        // supports
+        ASSERT_EQ(hipMemcpy(dA, hA.data(), size, hipMemcpyHostToDevice), hipSuccess);
+        status = hipblasSimatcopyStridedBatched(
+            handle, HIPBLAS_OP_T, rows, cols, &alpha, dA, rows, cols, rows * cols, batch);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+            ASSERT_EQ(hipMemcpy(hB.data(), dA, size, hipMemcpyDeviceToHost), hipSuccess);
+            for(size_t i = 0; i < hB.size(); i++)
+                EXPECT_EQ(hB[i], expected[i]);
+        }
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+    }
+
 } // namespace
@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "blas3/testing_omatcopy.hpp"
+#include "blas3/testing_omatcopy_batched.hpp"
+#include "blas3/testing_omatcopy_strided_batched.hpp"
+#include "blas3/testing_imatcopy.hpp"
+#include "blas3/testing_imatcopy_batched.hpp"
+#include "blas3/testing_imatcopy_strided_batched.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible matcopy test cases
+    enum matcopy_test_type
+    {
+        OMATCOPY,
+        OMATCOPY_BATCHED,
+        OMATCOPY_STRIDED_BATCHED,
+        IMATCOPY,
+        IMATCOPY_BATCHED,
+        IMATCOPY_STRIDED_BATCHED,
+    };
+
+    // matcopy test template
+    template <template <typename...> class FILTER, matcopy_test_type MATCOPY_TYPE>
+    struct matcopy_template : HipBLAS_Test<matcopy_template<FILTER, MATCOPY_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<matcopy_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(MATCOPY_TYPE)
+            {
+            case OMATCOPY:
+                return !strcmp(arg.function, "omatcopy");
+            case OMATCOPY_BATCHED:
+                return !strcmp(arg.function, "omatcopy_batched");
+            case OMATCOPY_STRIDED_BATCHED:
+                return !strcmp(arg.function, "omatcopy_strided_batched");
+            case IMATCOPY:
+                return !strcmp(arg.function, "imatcopy");
+            case IMATCOPY_BATCHED:
+                return !strcmp(arg.function, "imatcopy_batched");
+            case IMATCOPY_STRIDED_BATCHED:
+                return !strcmp(arg.function, "imatcopy_strided_batched");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(MATCOPY_TYPE == OMATCOPY)
+                testname_omatcopy(arg, name);
+            else if constexpr(MATCOPY_TYPE == OMATCOPY_BATCHED)
+                testname_omatcopy_batched(arg, name);
+            else if constexpr(MATCOPY_TYPE == OMATCOPY_STRIDED_BATCHED)
+                testname_omatcopy_strided_batched(arg, name);
+            else if constexpr(MATCOPY_TYPE == IMATCOPY)
+                testname_imatcopy(arg, name);
+            else if constexpr(MATCOPY_TYPE == IMATCOPY_BATCHED)
+                testname_imatcopy_batched(arg, name);
+            else if constexpr(MATCOPY_TYPE == IMATCOPY_STRIDED_BATCHED)
+                testname_imatcopy_strided_batched(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct matcopy_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct matcopy_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "omatcopy"))
+                testing_omatcopy<T>(arg);
+            else if(!strcmp(arg.function, "omatcopy_batched"))
+                testing_omatcopy_batched<T>(arg);
+            else if(!strcmp(arg.function, "omatcopy_strided_batched"))
+                testing_omatcopy_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "imatcopy"))
+                testing_imatcopy<T>(arg);
+            else if(!strcmp(arg.function, "imatcopy_batched"))
+                testing_imatcopy_batched<T>(arg);
+            else if(!strcmp(arg.function, "imatcopy_strided_batched"))
+                testing_imatcopy_strided_batched<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using omatcopy = matcopy_template<matcopy_testing, OMATCOPY>;
+    TEST_P(omatcopy, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<matcopy_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(omatcopy);
+
+    using omatcopy_batched = matcopy_template<matcopy_testing, OMATCOPY_BATCHED>;
+    TEST_P(omatcopy_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<matcopy_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(omatcopy_batched);
+
+    using omatcopy_strided_batched = matcopy_template<matcopy_testing, OMATCOPY_STRIDED_BATCHED>;
+    TEST_P(omatcopy_strided_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<matcopy_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(omatcopy_strided_batched);
+
+    using imatcopy = matcopy_template<matcopy_testing, IMATCOPY>;
+    TEST_P(imatcopy, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<matcopy_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(imatcopy);
+
+    using imatcopy_batched = matcopy_template<matcopy_testing, IMATCOPY_BATCHED>;
+    TEST_P(imatcopy_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<matcopy_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(imatcopy_batched);
+
+    using imatcopy_strided_batched = matcopy_template<matcopy_testing, IMATCOPY_STRIDED_BATCHED>;
+    TEST_P(imatcopy_strided_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<matcopy_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(imatcopy_strided_batched);
+
+} // namespace
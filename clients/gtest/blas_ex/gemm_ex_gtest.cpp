@@ -22,6 +22,8 @@
 
 #include "blas_ex/testing_gemm_batched_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_ex_with_epilogue.hpp"
+#include "blas_ex/testing_gemm_grouped_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +37,8 @@ namespace
         GEMM_EX,
         GEMM_BATCHED_EX,
         GEMM_STRIDED_BATCHED_EX,
+        GEMM_GROUPED_EX,
+        GEMM_EX_WITH_EPILOGUE,
     };
 
     // gemm test template
@@ -72,6 +76,12 @@ namespace
                 return !strcmp(arg.function, "gemm_batched_ex");
             case GEMM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "gemm_strided_batched_ex");
+            case GEMM_GROUPED_EX:
+                return !strcmp(arg.function, "gemm_grouped_ex")
+                       || !strcmp(arg.function, "gemm_grouped_ex_bad_arg");
+            case GEMM_EX_WITH_EPILOGUE:
+                return !strcmp(arg.function, "gemm_ex_with_epilogue")
+                       || !strcmp(arg.function, "gemm_ex_with_epilogue_bad_arg");
             }
             return false;
         }
@@ -86,6 +96,10 @@ namespace
                 testname_gemm_batched_ex(arg, name);
             else if constexpr(GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_EX)
                 testname_gemm_strided_batched_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_GROUPED_EX)
+                testname_gemm_grouped_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_EX_WITH_EPILOGUE)
+                testname_gemm_ex_with_epilogue(arg, name);
             return std::move(name);
         }
     };
@@ -118,6 +132,10 @@ namespace
                 testing_gemm_batched_ex<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_strided_batched_ex"))
                 testing_gemm_strided_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_ex"))
+                testing_gemm_grouped_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_ex_bad_arg"))
+                testing_gemm_grouped_ex_bad_arg<Ti, To, Tc>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -147,4 +165,44 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_ex);
 
+    using gemm_grouped_ex = gemm_ex_template<gemm_ex_testing, GEMM_GROUPED_EX>;
+    TEST_P(gemm_grouped_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_ex);
+
+    // The epilogue is tested with real single and double precision only
+    template <typename T, typename = void>
+    struct gemm_ex_with_epilogue_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gemm_ex_with_epilogue_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_ex_with_epilogue"))
+                testing_gemm_ex_with_epilogue<T>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_epilogue_bad_arg"))
+                testing_gemm_ex_with_epilogue_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_ex_with_epilogue
+        = gemm_ex_template<gemm_ex_with_epilogue_testing, GEMM_EX_WITH_EPILOGUE>;
+    TEST_P(gemm_ex_with_epilogue, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_ex_with_epilogue_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ex_with_epilogue);
+
 } // namespace
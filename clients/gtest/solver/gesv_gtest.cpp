@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "solver/testing_dsgesv.hpp"
+#include "solver/testing_gesv_batched.hpp"
+#include "solver/testing_gesv_strided_batched.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible gesv test cases
+    enum gesv_test_type
+    {
+        DSGESV,
+        GESV_BATCHED,
+        GESV_STRIDED_BATCHED,
+    };
+
+    //gesv test template
+    template <template <typename...> class FILTER, gesv_test_type GESV_TYPE>
+    struct gesv_template : HipBLAS_Test<gesv_template<FILTER, GESV_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<gesv_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GESV_TYPE)
+            {
+            case DSGESV:
+                return !strcmp(arg.function, "dsgesv") || !strcmp(arg.function, "dsgesv_bad_arg");
+            case GESV_BATCHED:
+                return !strcmp(arg.function, "gesv_batched")
+                       || !strcmp(arg.function, "gesv_batched_bad_arg");
+            case GESV_STRIDED_BATCHED:
+                return !strcmp(arg.function, "gesv_strided_batched")
+                       || !strcmp(arg.function, "gesv_strided_batched_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(GESV_TYPE == DSGESV)
+                testname_dsgesv(arg, name);
+            else if constexpr(GESV_TYPE == GESV_BATCHED)
+                testname_gesv_batched(arg, name);
+            else if constexpr(GESV_TYPE == GESV_STRIDED_BATCHED)
+                testname_gesv_strided_batched(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct dsgesv_testing : hipblas_test_invalid
+    {
+    };
+
+    // dsgesv solves double precision systems only
+    template <typename T>
+    struct dsgesv_testing<T, std::enable_if_t<std::is_same_v<T, double>>> : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "dsgesv"))
+                testing_dsgesv<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <typename, typename = void>
+    struct gesv_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct gesv_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gesv_batched"))
+                testing_gesv_batched<T>(arg);
+            else if(!strcmp(arg.function, "gesv_strided_batched"))
+                testing_gesv_strided_batched<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using dsgesv = gesv_template<dsgesv_testing, DSGESV>;
+    TEST_P(dsgesv, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<dsgesv_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(dsgesv);
+
+    using gesv_batched = gesv_template<gesv_testing, GESV_BATCHED>;
+    TEST_P(gesv_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<gesv_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesv_batched);
+
+    using gesv_strided_batched = gesv_template<gesv_testing, GESV_STRIDED_BATCHED>;
+    TEST_P(gesv_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<gesv_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesv_strided_batched);
+
+} // namespace
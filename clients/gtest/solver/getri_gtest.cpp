@@ -22,8 +22,10 @@
 
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
+#include "solver/testing_getri.hpp"
 #include "solver/testing_getri_batched.hpp"
 #include "solver/testing_getri_npvt_batched.hpp"
+#include "solver/testing_getri_strided_batched.hpp"
 #include "type_dispatch.hpp"
 
 namespace
@@ -31,8 +33,10 @@ namespace
     // possible getri test cases
     enum getri_test_type
     {
+        GETRI,
         GETRI_BATCHED,
-        GETRI_NPVT_BATCHED
+        GETRI_NPVT_BATCHED,
+        GETRI_STRIDED_BATCHED
     };
 
     //getri test template
@@ -64,10 +68,14 @@ namespace
         {
             switch(GETRI_TYPE)
             {
+            case GETRI:
+                return !strcmp(arg.function, "getri");
             case GETRI_BATCHED:
                 return !strcmp(arg.function, "getri_batched");
             case GETRI_NPVT_BATCHED:
                 return !strcmp(arg.function, "getri_npvt_batched");
+            case GETRI_STRIDED_BATCHED:
+                return !strcmp(arg.function, "getri_strided_batched");
             }
             return false;
         }
@@ -76,10 +84,14 @@ namespace
         static std::string name_suffix(const Arguments& arg)
         {
             std::string name;
-            if constexpr(GETRI_TYPE == GETRI_BATCHED)
+            if constexpr(GETRI_TYPE == GETRI)
+                testname_getri(arg, name);
+            else if constexpr(GETRI_TYPE == GETRI_BATCHED)
                 testname_getri_batched(arg, name);
             else if constexpr(GETRI_TYPE == GETRI_NPVT_BATCHED)
                 testname_getri_npvt_batched(arg, name);
+            else if constexpr(GETRI_TYPE == GETRI_STRIDED_BATCHED)
+                testname_getri_strided_batched(arg, name);
             return std::move(name);
         }
     };
@@ -104,15 +116,27 @@ namespace
     {
         void operator()(const Arguments& arg)
         {
-            if(!strcmp(arg.function, "getri_batched"))
+            if(!strcmp(arg.function, "getri"))
+                testing_getri<T>(arg);
+            else if(!strcmp(arg.function, "getri_batched"))
                 testing_getri_batched<T>(arg);
             else if(!strcmp(arg.function, "getri_npvt_batched"))
                 testing_getri_npvt_batched<T>(arg);
+            else if(!strcmp(arg.function, "getri_strided_batched"))
+                testing_getri_strided_batched<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
     };
 
+    using getri = getri_template<getri_testing, GETRI>;
+    TEST_P(getri, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<getri_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(getri);
+
     using getri_batched = getri_template<getri_testing, GETRI_BATCHED>;
     TEST_P(getri_batched, solver)
     {
@@ -129,4 +153,12 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(getri_npvt_batched);
 
+    using getri_strided_batched = getri_template<getri_testing, GETRI_STRIDED_BATCHED>;
+    TEST_P(getri_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<getri_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(getri_strided_batched);
+
 } // namespace
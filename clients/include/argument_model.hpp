@@ -204,7 +204,9 @@ public:
         std::replace(params.begin(), params.end(), '-', 'n');
         std::replace(params.begin(), params.end(), '.', 'p');
         name += params;
-        name += (arg.api == hipblas_client_api::FORTRAN ? "_F" : "_C");
+        name += arg.api == hipblas_client_api::FORTRAN ? "_F"
+                : arg.api == hipblas_client_api::C_64  ? "_C64"
+                                                       : "_C";
     }
 };
 
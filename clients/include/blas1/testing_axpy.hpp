@@ -40,14 +40,15 @@ template <typename T>
 void testing_axpy(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasAxpyFn = FORTRAN ? hipblasAxpy<T, true> : hipblasAxpy<T, false>;
+    auto hipblasAxpyFn    = FORTRAN ? hipblasAxpy<T, true> : hipblasAxpy<T, false>;
+    auto hipblasAxpyFn_64 = hipblasAxpy_64<T>;
 
-    int N    = arg.N;
-    int incx = arg.incx;
-    int incy = arg.incy;
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
 
-    int abs_incx = incx < 0 ? -incx : incx;
-    int abs_incy = incy < 0 ? -incy : incy;
+    int64_t abs_incx = incx < 0 ? -incx : incx;
+    int64_t abs_incy = incy < 0 ? -incy : incy;
 
     hipblasLocalHandle handle(arg);
 
@@ -55,7 +56,7 @@ void testing_axpy(const Arguments& arg)
     // memory
     if(N <= 0)
     {
-        ASSERT_HIPBLAS_SUCCESS(hipblasAxpyFn(handle, N, nullptr, nullptr, incx, nullptr, incy));
+        DAPI_CHECK(hipblasAxpyFn, (handle, N, nullptr, nullptr, incx, nullptr, incy));
         return;
     }
 
@@ -104,10 +105,10 @@ void testing_axpy(const Arguments& arg)
                     HIPBLAS
         =================================================================== */
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        ASSERT_HIPBLAS_SUCCESS(hipblasAxpyFn(handle, N, d_alpha, dx, incx, dy_device, incy));
+        DAPI_CHECK(hipblasAxpyFn, (handle, N, d_alpha, dx, incx, dy_device, incy));
 
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        ASSERT_HIPBLAS_SUCCESS(hipblasAxpyFn(handle, N, &alpha, dx, incx, dy_host, incy));
+        DAPI_CHECK(hipblasAxpyFn, (handle, N, &alpha, dx, incx, dy_host, incy));
 
         // copy output from device to CPU
         ASSERT_HIP_SUCCESS(
@@ -147,7 +148,7 @@ void testing_axpy(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            ASSERT_HIPBLAS_SUCCESS(hipblasAxpyFn(handle, N, d_alpha, dx, incx, dy_device, incy));
+            DAPI_CHECK(hipblasAxpyFn, (handle, N, d_alpha, dx, incx, dy_device, incy));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
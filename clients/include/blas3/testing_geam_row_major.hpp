@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGeamRowMajorModel
+    = ArgumentModel<e_a_type, e_transA, e_transB, e_M, e_N, e_alpha, e_lda, e_beta, e_ldb, e_ldc>;
+
+inline void testname_geam_row_major(const Arguments& arg, std::string& name)
+{
+    hipblasGeamRowMajorModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_geam_row_major(const Arguments& arg)
+{
+    auto hipblasGeamRowMajorFn = hipblasGeamRowMajor<T>;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // Matrices are stored in row-major order, so leading dimensions bound the number of columns
+    int A_row = transA == HIPBLAS_OP_N ? M : N;
+    int A_col = transA == HIPBLAS_OP_N ? N : M;
+    int B_row = transB == HIPBLAS_OP_N ? M : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : M;
+
+    size_t A_size = size_t(lda) * A_row;
+    size_t B_size = size_t(ldb) * B_row;
+    size_t C_size = size_t(ldc) * M;
+
+    // check here to prevent undefined memory allocation error
+    if(M <= 0 || N <= 0 || lda < A_col || ldb < B_col || ldc < N)
+    {
+        return;
+    }
+
+    // allocate memory on device
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC1(C_size);
+    host_vector<T> hC2(C_size);
+    host_vector<T> hC_copy(C_size);
+
+    // A row-major matrix is initialized as its column-major transpose
+    hipblas_init_matrix(hA, arg, A_col, A_row, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB, arg, B_col, B_row, ldb, 0, 1, hipblas_client_beta_sets_nan);
+    hipblas_init_matrix(hC1, arg, N, M, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+    hC2     = hC1;
+    hC_copy = hC1;
+
+    // copy data from CPU to device
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC1.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        {
+            // &h_alpha and &h_beta are host pointers
+            ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            ASSERT_HIPBLAS_SUCCESS(hipblasGeamRowMajorFn(
+                handle, transA, transB, M, N, &h_alpha, dA, lda, &h_beta, dB, ldb, dC, ldc));
+
+            ASSERT_HIP_SUCCESS(
+                hipMemcpy(hC1.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        }
+        {
+            ASSERT_HIP_SUCCESS(
+                hipMemcpy(dC, hC2.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+            // d_alpha and d_beta are device pointers
+            ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            ASSERT_HIPBLAS_SUCCESS(hipblasGeamRowMajorFn(
+                handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
+
+            ASSERT_HIP_SUCCESS(
+                hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        }
+
+        /* =====================================================================
+                CPU BLAS
+        =================================================================== */
+        // The column-major reference is computed on column-major copies
+        host_vector<T> hA_col(size_t(A_row) * A_col);
+        host_vector<T> hB_col(size_t(B_row) * B_col);
+        host_vector<T> hC_col(size_t(M) * N);
+        row_to_col_major<T>(hA, lda, hA_col, A_row, A_row, A_col);
+        row_to_col_major<T>(hB, ldb, hB_col, B_row, B_row, B_col);
+
+        cblas_geam(transA,
+                   transB,
+                   M,
+                   N,
+                   &h_alpha,
+                   (T*)hA_col,
+                   A_row,
+                   &h_beta,
+                   (T*)hB_col,
+                   B_row,
+                   (T*)hC_col,
+                   M);
+
+        col_to_row_major<T>(hC_col, M, hC_copy, ldc, M, N);
+
+        // enable unit check, notice unit check is not invasive, but norm check is,
+        // unit check and norm check can not be interchanged their order
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, M, ldc, hC_copy.data(), hC1.data());
+            unit_check_general<T>(N, M, ldc, hC_copy.data(), hC2.data());
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>('F', N, M, ldc, hC_copy.data(), hC1.data());
+            hipblas_error_device
+                = norm_check_general<T>('F', N, M, ldc, hC_copy.data(), hC2.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasGeamRowMajorFn(
+                handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasGeamRowMajorModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               geam_gflop_count<T>(M, N),
+                                               geam_gbyte_count<T>(M, N),
+                                               hipblas_error_host,
+                                               hipblas_error_device);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_geam_row_major_ret(const Arguments& arg)
+{
+    testing_geam_row_major<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -51,22 +51,23 @@ inline void testname_gemm(const Arguments& arg, std::string& name)
 template <typename T>
 void testing_gemm(const Arguments& arg)
 {
-    bool FORTRAN       = arg.fortran;
-    auto hipblasGemmFn = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+    bool FORTRAN          = arg.fortran;
+    auto hipblasGemmFn    = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+    auto hipblasGemmFn_64 = hipblasGemm_64<T>;
 
     hipblasOperation_t transA = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB = char2hipblas_operation(arg.transB);
-    int                M      = arg.M;
-    int                N      = arg.N;
-    int                K      = arg.K;
-    int                lda    = arg.lda;
-    int                ldb    = arg.ldb;
-    int                ldc    = arg.ldc;
+    int64_t            M      = arg.M;
+    int64_t            N      = arg.N;
+    int64_t            K      = arg.K;
+    int64_t            lda    = arg.lda;
+    int64_t            ldb    = arg.ldb;
+    int64_t            ldc    = arg.ldc;
 
     T h_alpha = arg.get_alpha<T>();
     T h_beta  = arg.get_beta<T>();
 
-    int A_row, A_col, B_row, B_col;
+    int64_t A_row, A_col, B_row, B_col;
 
     if(transA == HIPBLAS_OP_N)
     {
@@ -141,16 +142,42 @@ void testing_gemm(const Arguments& arg)
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
         // library interface
-        ASSERT_HIPBLAS_SUCCESS(hipblasGemmFn(
-            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    &h_alpha,
+                    dA,
+                    lda,
+                    dB,
+                    ldb,
+                    &h_beta,
+                    dC,
+                    ldc));
 
         // copy output from device to CPU
         ASSERT_HIP_SUCCESS(hipMemcpy(hC_host, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
 
         ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC_device, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        ASSERT_HIPBLAS_SUCCESS(hipblasGemmFn(
-            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    d_alpha,
+                    dA,
+                    lda,
+                    dB,
+                    ldb,
+                    d_beta,
+                    dC,
+                    ldc));
         ASSERT_HIP_SUCCESS(hipMemcpy(hC_device, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
 
         /* =====================================================================
@@ -210,8 +237,21 @@ void testing_gemm(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            ASSERT_HIPBLAS_SUCCESS(hipblasGemmFn(
-                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+            DAPI_CHECK(hipblasGemmFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        &h_alpha,
+                        dA,
+                        lda,
+                        dB,
+                        ldb,
+                        &h_beta,
+                        dC,
+                        ldc));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmRowMajorModel = ArgumentModel<e_a_type,
+                                               e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc>;
+
+inline void testname_gemm_row_major(const Arguments& arg, std::string& name)
+{
+    hipblasGemmRowMajorModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gemm_row_major(const Arguments& arg)
+{
+    auto hipblasGemmRowMajorFn = hipblasGemmRowMajor<T>;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Matrices are stored in row-major order, so leading dimensions bound the number of columns
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    size_t A_size = size_t(lda) * A_row;
+    size_t B_size = size_t(ldb) * B_row;
+    size_t C_size = size_t(ldc) * M;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_col || ldb < B_col || ldc < N)
+    {
+        return;
+    }
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // A row-major matrix is initialized as its column-major transpose
+    hipblas_init_matrix(hA, arg, A_col, A_row, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_col, B_row, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC_host, arg, N, M, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+    hC_device = hC_host;
+    hC_gold   = hC_host;
+
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        ASSERT_HIPBLAS_SUCCESS(hipblasGemmRowMajorFn(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+        ASSERT_HIP_SUCCESS(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        ASSERT_HIPBLAS_SUCCESS(hipblasGemmRowMajorFn(
+            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+        ASSERT_HIP_SUCCESS(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        // The column-major reference is computed on column-major copies of the matrices
+        int            lda_col = std::max(1, A_row), ldb_col = std::max(1, B_row);
+        int            ldc_col = std::max(1, M);
+        host_vector<T> hA_col(size_t(lda_col) * A_col);
+        host_vector<T> hB_col(size_t(ldb_col) * B_col);
+        host_vector<T> hC_col(size_t(ldc_col) * N);
+        row_to_col_major<T>(hA, lda, hA_col, lda_col, A_row, A_col);
+        row_to_col_major<T>(hB, ldb, hB_col, ldb_col, B_row, B_col);
+        row_to_col_major<T>(hC_gold, ldc, hC_col, ldc_col, M, N);
+
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA_col.data(),
+                      lda_col,
+                      hB_col.data(),
+                      ldb_col,
+                      h_beta,
+                      hC_col.data(),
+                      ldc_col);
+        col_to_row_major<T>(hC_col, ldc_col, hC_gold, ldc, M, N);
+
+        // Each row of C is a column of the column-major matrix with the same storage
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, M, ldc, hC_gold, hC_host);
+            unit_check_general<T>(N, M, ldc, hC_gold, hC_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host = std::abs(norm_check_general<T>('F', N, M, ldc, hC_gold, hC_host));
+            hipblas_error_device
+                = std::abs(norm_check_general<T>('F', N, M, ldc, hC_gold, hC_device));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasGemmRowMajorFn(
+                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmRowMajorModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               gemm_gflop_count<T>(M, N, K),
+                                               gemm_gbyte_count<T>(M, N, K),
+                                               hipblas_error_host,
+                                               hipblas_error_device);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_gemm_row_major_ret(const Arguments& arg)
+{
+    testing_gemm_row_major<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -44,7 +44,8 @@ using hipblasGemmStridedBatchedModel = ArgumentModel<e_a_type,
                                                      e_beta,
                                                      e_ldc,
                                                      e_stride_scale,
-                                                     e_batch_count>;
+                                                     e_batch_count,
+                                                     e_with_scalar_arrays>;
 
 inline void testname_gemm_strided_batched(const Arguments& arg, std::string& name)
 {
@@ -58,6 +59,10 @@ void testing_gemm_strided_batched(const Arguments& arg)
     auto hipblasGemmStridedBatchedFn
         = FORTRAN ? hipblasGemmStridedBatched<T, true> : hipblasGemmStridedBatched<T, false>;
 
+    // alpha and beta have one scalar per batch in the WithScalarArrays variant
+    if(arg.with_scalar_arrays)
+        hipblasGemmStridedBatchedFn = hipblasGemmStridedBatchedWithScalarArrays<T>;
+
     hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
     int                M            = arg.M;
@@ -69,9 +74,6 @@ void testing_gemm_strided_batched(const Arguments& arg)
     double             stride_scale = arg.stride_scale;
     int                batch_count  = arg.batch_count;
 
-    T h_alpha = arg.get_alpha<T>();
-    T h_beta  = arg.get_beta<T>();
-
     int A_row, A_col, B_row, B_col;
 
     if(transA == HIPBLAS_OP_N)
@@ -119,8 +121,10 @@ void testing_gemm_strided_batched(const Arguments& arg)
     device_vector<T> dA(A_size);
     device_vector<T> dB(B_size);
     device_vector<T> dC(C_size);
-    device_vector<T> d_alpha(1);
-    device_vector<T> d_beta(1);
+    host_vector<T>   h_alpha(batch_count);
+    host_vector<T>   h_beta(batch_count);
+    device_vector<T> d_alpha(batch_count);
+    device_vector<T> d_beta(batch_count);
 
     // Initial Data on CPU
     hipblas_init_matrix(
@@ -129,6 +133,7 @@ void testing_gemm_strided_batched(const Arguments& arg)
         hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
     hipblas_init_matrix(
         hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    hipblas_init_batch_scalars(h_alpha, h_beta, arg, batch_count);
 
     // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
     hC_copy   = hC_host;
@@ -138,8 +143,9 @@ void testing_gemm_strided_batched(const Arguments& arg)
     ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
     ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
     ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
-    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
-    ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(
+        hipMemcpy(d_alpha, h_alpha, sizeof(T) * batch_count, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, h_beta, sizeof(T) * batch_count, hipMemcpyHostToDevice));
 
     double             gpu_time_used, hipblas_error_host, hipblas_error_device;
     hipblasLocalHandle handle(arg);
@@ -159,14 +165,14 @@ void testing_gemm_strided_batched(const Arguments& arg)
                                                            M,
                                                            N,
                                                            K,
-                                                           &h_alpha,
+                                                           h_alpha,
                                                            dA,
                                                            lda,
                                                            stride_A,
                                                            dB,
                                                            ldb,
                                                            stride_B,
-                                                           &h_beta,
+                                                           h_beta,
                                                            dC,
                                                            ldc,
                                                            stride_C,
@@ -201,22 +207,23 @@ void testing_gemm_strided_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int i = 0; i < batch_count; i++)
-        {
-            cblas_gemm<T>(transA,
-                          transB,
-                          M,
-                          N,
-                          K,
-                          h_alpha,
-                          hA.data() + stride_A * i,
-                          lda,
-                          hB.data() + stride_B * i,
-                          ldb,
-                          h_beta,
-                          hC_copy.data() + stride_C * i,
-                          ldc);
-        }
+        cblas_gemm_strided_batched<T>(transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      h_alpha.data(),
+                                      hA.data(),
+                                      lda,
+                                      stride_A,
+                                      hB.data(),
+                                      ldb,
+                                      stride_B,
+                                      h_beta.data(),
+                                      hC_copy.data(),
+                                      ldc,
+                                      stride_C,
+                                      batch_count);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -264,14 +271,14 @@ void testing_gemm_strided_batched(const Arguments& arg)
                                                                M,
                                                                N,
                                                                K,
-                                                               &h_alpha,
+                                                               h_alpha,
                                                                dA,
                                                                lda,
                                                                stride_A,
                                                                dB,
                                                                ldb,
                                                                stride_B,
-                                                               &h_beta,
+                                                               h_beta,
                                                                dC,
                                                                ldc,
                                                                stride_C,
@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasImatcopyStridedBatchedModel = ArgumentModel<e_a_type,
+                                                         e_transA,
+                                                         e_M,
+                                                         e_N,
+                                                         e_alpha,
+                                                         e_lda,
+                                                         e_ldb,
+                                                         e_stride_scale,
+                                                         e_batch_count>;
+
+inline void testname_imatcopy_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasImatcopyStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_imatcopy_strided_batched(const Arguments& arg)
+{
+    auto hipblasImatcopyStridedBatchedFn = hipblasImatcopyStridedBatched<T>;
+
+    hipblasOperation_t trans        = char2hipblas_operation(arg.transA);
+    int                rows         = arg.M;
+    int                cols         = arg.N;
+    int                lda          = arg.lda;
+    int                ldb          = arg.ldb;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_zero  = T(0);
+    T h_one   = T(1);
+
+    // Each AB_i is rows x cols with leading dimension lda on input, and m x n with leading
+    // dimension ldb on output
+    int m = trans == HIPBLAS_OP_N ? rows : cols;
+    int n = trans == HIPBLAS_OP_N ? cols : rows;
+
+    hipblasStride stride_AB
+        = std::max(size_t(lda) * cols, size_t(ldb) * n) * std::max(stride_scale, 1.0);
+
+    size_t AB_size = stride_AB * batch_count;
+
+    // check here to prevent undefined memory allocation error
+    if(rows <= 0 || cols <= 0 || lda < rows || ldb < m || batch_count <= 0)
+    {
+        return;
+    }
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // allocate memory on device
+    device_vector<T> dAB(AB_size);
+    device_vector<T> d_alpha(1);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hAB(AB_size);
+    host_vector<T> hAB_host(AB_size);
+    host_vector<T> hAB_device(AB_size);
+    host_vector<T> hAB_gold(AB_size);
+    host_vector<T> hS(size_t(m) * n);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hAB, arg, rows, cols, lda, stride_AB, batch_count, hipblas_client_alpha_sets_nan, true);
+
+    hAB_gold = hAB;
+
+    // copy data from CPU to device
+    ASSERT_HIP_SUCCESS(hipMemcpy(dAB, hAB.data(), sizeof(T) * AB_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        ASSERT_HIPBLAS_SUCCESS(hipblasImatcopyStridedBatchedFn(
+            handle, trans, rows, cols, &h_alpha, dAB, lda, ldb, stride_AB, batch_count));
+
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(hAB_host.data(), dAB, sizeof(T) * AB_size, hipMemcpyDeviceToHost));
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(dAB, hAB.data(), sizeof(T) * AB_size, hipMemcpyHostToDevice));
+
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        ASSERT_HIPBLAS_SUCCESS(hipblasImatcopyStridedBatchedFn(
+            handle, trans, rows, cols, d_alpha, dAB, lda, ldb, stride_AB, batch_count));
+
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(hAB_device.data(), dAB, sizeof(T) * AB_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                CPU BLAS
+        =================================================================== */
+        // op( AB_i ) is formed out of place, then copied back with leading dimension ldb
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_geam(trans,
+                       trans,
+                       m,
+                       n,
+                       &h_alpha,
+                       (T*)hAB + b * stride_AB,
+                       lda,
+                       &h_zero,
+                       (T*)hAB + b * stride_AB,
+                       lda,
+                       (T*)hS,
+                       m);
+            cblas_geam(HIPBLAS_OP_N,
+                       HIPBLAS_OP_N,
+                       m,
+                       n,
+                       &h_one,
+                       (T*)hS,
+                       m,
+                       &h_zero,
+                       (T*)hS,
+                       m,
+                       (T*)hAB_gold + b * stride_AB,
+                       ldb);
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(m, n, batch_count, ldb, stride_AB, hAB_gold, hAB_host);
+            unit_check_general<T>(m, n, batch_count, ldb, stride_AB, hAB_gold, hAB_device);
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', m, n, ldb, stride_AB, hAB_gold, hAB_host, batch_count);
+            hipblas_error_device = norm_check_general<T>(
+                'F', m, n, ldb, stride_AB, hAB_gold, hAB_device, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasImatcopyStridedBatchedFn(
+                handle, trans, rows, cols, d_alpha, dAB, lda, ldb, stride_AB, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasImatcopyStridedBatchedModel{}.log_args<T>(std::cout,
+                                                         arg,
+                                                         gpu_time_used,
+                                                         geam_gflop_count<T>(m, n),
+                                                         geam_gbyte_count<T>(m, n),
+                                                         hipblas_error_host,
+                                                         hipblas_error_device);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_imatcopy_strided_batched_ret(const Arguments& arg)
+{
+    testing_imatcopy_strided_batched<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
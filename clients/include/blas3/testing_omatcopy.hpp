@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasOmatcopyModel = ArgumentModel<e_a_type, e_transA, e_M, e_N, e_alpha, e_lda, e_ldb>;
+
+inline void testname_omatcopy(const Arguments& arg, std::string& name)
+{
+    hipblasOmatcopyModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_omatcopy(const Arguments& arg)
+{
+    auto hipblasOmatcopyFn = hipblasOmatcopy<T>;
+
+    hipblasOperation_t trans = char2hipblas_operation(arg.transA);
+    int                rows  = arg.M;
+    int                cols  = arg.N;
+    int                lda   = arg.lda;
+    int                ldb   = arg.ldb;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_zero  = T(0);
+
+    // B = alpha*op( A ) is m x n
+    int m = trans == HIPBLAS_OP_N ? rows : cols;
+    int n = trans == HIPBLAS_OP_N ? cols : rows;
+
+    size_t A_size = size_t(lda) * cols;
+    size_t B_size = size_t(ldb) * n;
+
+    // check here to prevent undefined memory allocation error
+    if(rows <= 0 || cols <= 0 || lda < rows || ldb < m)
+    {
+        return;
+    }
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // allocate memory on device
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> d_alpha(1);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_host(B_size);
+    host_vector<T> hB_device(B_size);
+    host_vector<T> hB_gold(B_size);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, rows, cols, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB, arg, m, n, ldb, 0, 1, hipblas_client_never_set_nan);
+
+    hB_gold = hB;
+
+    // copy data from CPU to device
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        ASSERT_HIPBLAS_SUCCESS(
+            hipblasOmatcopyFn(handle, trans, rows, cols, &h_alpha, dA, lda, dB, ldb));
+
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(hB_host.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+        ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        ASSERT_HIPBLAS_SUCCESS(
+            hipblasOmatcopyFn(handle, trans, rows, cols, d_alpha, dA, lda, dB, ldb));
+
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(hB_device.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                CPU BLAS
+        =================================================================== */
+        cblas_geam(
+            trans, trans, m, n, &h_alpha, (T*)hA, lda, &h_zero, (T*)hA, lda, (T*)hB_gold, ldb);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(m, n, ldb, hB_gold.data(), hB_host.data());
+            unit_check_general<T>(m, n, ldb, hB_gold.data(), hB_device.data());
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', m, n, ldb, hB_gold.data(), hB_host.data());
+            hipblas_error_device
+                = norm_check_general<T>('F', m, n, ldb, hB_gold.data(), hB_device.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(
+                hipblasOmatcopyFn(handle, trans, rows, cols, d_alpha, dA, lda, dB, ldb));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasOmatcopyModel{}.log_args<T>(std::cout,
+                                           arg,
+                                           gpu_time_used,
+                                           geam_gflop_count<T>(m, n),
+                                           geam_gbyte_count<T>(m, n),
+                                           hipblas_error_host,
+                                           hipblas_error_device);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_omatcopy_ret(const Arguments& arg)
+{
+    testing_omatcopy<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
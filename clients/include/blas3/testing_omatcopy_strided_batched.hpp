@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasOmatcopyStridedBatchedModel = ArgumentModel<e_a_type,
+                                                         e_transA,
+                                                         e_M,
+                                                         e_N,
+                                                         e_alpha,
+                                                         e_lda,
+                                                         e_ldb,
+                                                         e_stride_scale,
+                                                         e_batch_count>;
+
+inline void testname_omatcopy_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasOmatcopyStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_omatcopy_strided_batched(const Arguments& arg)
+{
+    auto hipblasOmatcopyStridedBatchedFn = hipblasOmatcopyStridedBatched<T>;
+
+    hipblasOperation_t trans        = char2hipblas_operation(arg.transA);
+    int                rows         = arg.M;
+    int                cols         = arg.N;
+    int                lda          = arg.lda;
+    int                ldb          = arg.ldb;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_zero  = T(0);
+
+    // B_i = alpha*op( A_i ) is m x n
+    int m = trans == HIPBLAS_OP_N ? rows : cols;
+    int n = trans == HIPBLAS_OP_N ? cols : rows;
+
+    hipblasStride stride_A = size_t(lda) * cols * stride_scale;
+    hipblasStride stride_B = size_t(ldb) * n * stride_scale;
+
+    size_t A_size = stride_A * batch_count;
+    size_t B_size = stride_B * batch_count;
+
+    // check here to prevent undefined memory allocation error
+    if(rows <= 0 || cols <= 0 || lda < rows || ldb < m || batch_count <= 0)
+    {
+        return;
+    }
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // allocate memory on device
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> d_alpha(1);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_host(B_size);
+    host_vector<T> hB_device(B_size);
+    host_vector<T> hB_gold(B_size);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hA, arg, rows, cols, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB, arg, m, n, ldb, stride_B, batch_count, hipblas_client_never_set_nan);
+
+    hB_gold = hB;
+
+    // copy data from CPU to device
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        ASSERT_HIPBLAS_SUCCESS(hipblasOmatcopyStridedBatchedFn(handle,
+                                                               trans,
+                                                               rows,
+                                                               cols,
+                                                               &h_alpha,
+                                                               dA,
+                                                               lda,
+                                                               stride_A,
+                                                               dB,
+                                                               ldb,
+                                                               stride_B,
+                                                               batch_count));
+
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(hB_host.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+        ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        ASSERT_HIPBLAS_SUCCESS(hipblasOmatcopyStridedBatchedFn(handle,
+                                                               trans,
+                                                               rows,
+                                                               cols,
+                                                               d_alpha,
+                                                               dA,
+                                                               lda,
+                                                               stride_A,
+                                                               dB,
+                                                               ldb,
+                                                               stride_B,
+                                                               batch_count));
+
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(hB_device.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_geam(trans,
+                       trans,
+                       m,
+                       n,
+                       &h_alpha,
+                       (T*)hA + b * stride_A,
+                       lda,
+                       &h_zero,
+                       (T*)hA + b * stride_A,
+                       lda,
+                       (T*)hB_gold + b * stride_B,
+                       ldb);
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(m, n, batch_count, ldb, stride_B, hB_gold, hB_host);
+            unit_check_general<T>(m, n, batch_count, ldb, stride_B, hB_gold, hB_device);
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', m, n, ldb, stride_B, hB_gold, hB_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<T>('F', m, n, ldb, stride_B, hB_gold, hB_device, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasOmatcopyStridedBatchedFn(handle,
+                                                                   trans,
+                                                                   rows,
+                                                                   cols,
+                                                                   d_alpha,
+                                                                   dA,
+                                                                   lda,
+                                                                   stride_A,
+                                                                   dB,
+                                                                   ldb,
+                                                                   stride_B,
+                                                                   batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasOmatcopyStridedBatchedModel{}.log_args<T>(std::cout,
+                                                         arg,
+                                                         gpu_time_used,
+                                                         geam_gflop_count<T>(m, n),
+                                                         geam_gbyte_count<T>(m, n),
+                                                         hipblas_error_host,
+                                                         hipblas_error_device);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_omatcopy_strided_batched_ret(const Arguments& arg)
+{
+    testing_omatcopy_strided_batched<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
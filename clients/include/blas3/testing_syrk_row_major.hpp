@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSyrkRowMajorModel
+    = ArgumentModel<e_a_type, e_uplo, e_transA, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>;
+
+inline void testname_syrk_row_major(const Arguments& arg, std::string& name)
+{
+    hipblasSyrkRowMajorModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_syrk_row_major(const Arguments& arg)
+{
+    auto hipblasSyrkRowMajorFn = hipblasSyrkRowMajor<T>;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldc    = arg.ldc;
+
+    // A is A_row x A_col and C is N x N, both stored in row-major order
+    int A_row = transA == HIPBLAS_OP_N ? N : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : N;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || K < 0 || ldc < N || lda < A_col || lda < 1)
+    {
+        return;
+    }
+
+    size_t A_size = size_t(lda) * A_row;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // A row-major matrix is initialized as its column-major transpose
+    hipblas_init_matrix(hA, arg, A_col, A_row, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hC, arg, N, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+    hC_gold = hC;
+
+    // copy data from CPU to device
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSyrkRowMajorFn(
+            handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+
+        // copy output from device to CPU
+        ASSERT_HIP_SUCCESS(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        ASSERT_HIPBLAS_SUCCESS(
+            hipblasSyrkRowMajorFn(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+
+        ASSERT_HIP_SUCCESS(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        // The column-major reference is computed on column-major copies, which keep the
+        // logical elements and so the meaning of uplo
+        int            A_ld = std::max(1, A_row);
+        host_vector<T> hA_col(size_t(A_ld) * A_col);
+        host_vector<T> hC_col(size_t(N) * N);
+        row_to_col_major<T>(hA, lda, hA_col, A_ld, A_row, A_col);
+        row_to_col_major<T>(hC, ldc, hC_col, N, N, N);
+
+        cblas_syrk<T>(uplo, transA, N, K, h_alpha, hA_col, A_ld, h_beta, hC_col, N);
+
+        col_to_row_major<T>(hC_col, N, hC_gold, ldc, N, N);
+
+        // enable unit check, notice unit check is not invasive, but norm check is,
+        // unit check and norm check can not be interchanged their order
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_host);
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_device);
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_host   = norm_check_general<T>('F', N, N, ldc, hC_gold, hC_host);
+            hipblas_error_device = norm_check_general<T>('F', N, N, ldc, hC_gold, hC_device);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasSyrkRowMajorFn(
+                handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasSyrkRowMajorModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               syrk_gflop_count<T>(N, K),
+                                               syrk_gbyte_count<T>(N, K),
+                                               hipblas_error_host,
+                                               hipblas_error_device);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_syrk_row_major_ret(const Arguments& arg)
+{
+    testing_syrk_row_major<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
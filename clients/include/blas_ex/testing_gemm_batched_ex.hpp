@@ -48,7 +48,8 @@ using hipblasGemmBatchedExModel = ArgumentModel<e_a_type,
                                                 e_ldc,
                                                 e_batch_count,
                                                 e_with_flags,
-                                                e_flags>;
+                                                e_flags,
+                                                e_with_scalar_arrays>;
 
 inline void testname_gemm_batched_ex(const Arguments& arg, std::string& name)
 {
@@ -113,6 +114,15 @@ void testing_gemm_batched_ex(const Arguments& arg)
     device_vector<Tex>      d_alpha(1);
     device_vector<Tex>      d_beta(1);
 
+    // One alpha and beta for each batch, for the WithScalarArrays variant which takes
+    // hipDataType with or without HIPBLAS_V2
+    hipDataType        a_hip_type = hipblas_hip_datatype<Ti>;
+    hipDataType        c_hip_type = hipblas_hip_datatype<To>;
+    host_vector<Tex>   h_alpha(batch_count);
+    host_vector<Tex>   h_beta(batch_count);
+    device_vector<Tex> d_alpha_array(std::max(batch_count, 1));
+    device_vector<Tex> d_beta_array(std::max(batch_count, 1));
+
     ASSERT_HIP_SUCCESS(dA.memcheck());
     ASSERT_HIP_SUCCESS(dB.memcheck());
     ASSERT_HIP_SUCCESS(dC.memcheck());
@@ -132,6 +142,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
 
     hC_device.copy_from(hC_host);
     hC_gold.copy_from(hC_host);
+    hipblas_init_batch_scalars(h_alpha, h_beta, arg, batch_count);
 
     // Initial Data on CPU
     srand(1);
@@ -144,12 +155,40 @@ void testing_gemm_batched_ex(const Arguments& arg)
     ASSERT_HIP_SUCCESS(dC.transfer_from(hC_host));
     ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
     ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(
+        hipMemcpy(d_alpha_array, h_alpha, sizeof(Tex) * batch_count, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(
+        hipMemcpy(d_beta_array, h_beta, sizeof(Tex) * batch_count, hipMemcpyHostToDevice));
 
     if(unit_check || norm_check)
     {
         // hipBLAS
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        if(!arg.with_flags)
+        if(arg.with_scalar_arrays)
+        {
+            ASSERT_HIPBLAS_SUCCESS(
+                hipblasGemmBatchedExWithScalarArrays(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     h_alpha,
+                                                     (const void**)(Ti**)dA.ptr_on_device(),
+                                                     a_hip_type,
+                                                     lda,
+                                                     (const void**)(Ti**)dB.ptr_on_device(),
+                                                     a_hip_type,
+                                                     ldb,
+                                                     h_beta,
+                                                     (void**)(To**)dC.ptr_on_device(),
+                                                     c_hip_type,
+                                                     ldc,
+                                                     batch_count,
+                                                     compute_type_gemm,
+                                                     algo));
+        }
+        else if(!arg.with_flags)
         {
             ASSERT_HIPBLAS_SUCCESS(hipblasGemmBatchedExFn(handle,
                                                           transA,
@@ -210,7 +249,31 @@ void testing_gemm_batched_ex(const Arguments& arg)
         ASSERT_HIP_SUCCESS(dC.transfer_from(hC_device));
 
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        if(!arg.with_flags)
+        if(arg.with_scalar_arrays)
+        {
+            ASSERT_HIPBLAS_SUCCESS(
+                hipblasGemmBatchedExWithScalarArrays(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     d_alpha_array,
+                                                     (const void**)(Ti**)dA.ptr_on_device(),
+                                                     a_hip_type,
+                                                     lda,
+                                                     (const void**)(Ti**)dB.ptr_on_device(),
+                                                     a_hip_type,
+                                                     ldb,
+                                                     d_beta_array,
+                                                     (void**)(To**)dC.ptr_on_device(),
+                                                     c_hip_type,
+                                                     ldc,
+                                                     batch_count,
+                                                     compute_type_gemm,
+                                                     algo));
+        }
+        else if(!arg.with_flags)
         {
             ASSERT_HIPBLAS_SUCCESS(hipblasGemmBatchedExFn(handle,
                                                           transA,
@@ -277,12 +340,12 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                     M,
                                     N,
                                     K,
-                                    h_alpha_Tex,
+                                    h_alpha[b],
                                     hA[b],
                                     lda,
                                     hB[b],
                                     ldb,
-                                    h_beta_Tex,
+                                    h_beta[b],
                                     hC_gold[b],
                                     ldc);
         }
@@ -327,7 +390,31 @@ void testing_gemm_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            if(!arg.with_flags)
+            if(arg.with_scalar_arrays)
+            {
+                ASSERT_HIPBLAS_SUCCESS(
+                    hipblasGemmBatchedExWithScalarArrays(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         h_alpha,
+                                                         (const void**)(Ti**)dA.ptr_on_device(),
+                                                         a_hip_type,
+                                                         lda,
+                                                         (const void**)(Ti**)dB.ptr_on_device(),
+                                                         a_hip_type,
+                                                         ldb,
+                                                         h_beta,
+                                                         (void**)(To**)dC.ptr_on_device(),
+                                                         c_hip_type,
+                                                         ldc,
+                                                         batch_count,
+                                                         compute_type_gemm,
+                                                         algo));
+            }
+            else if(!arg.with_flags)
             {
                 ASSERT_HIPBLAS_SUCCESS(
                     hipblasGemmBatchedExFn(handle,
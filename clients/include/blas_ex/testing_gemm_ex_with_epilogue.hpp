@@ -0,0 +1,393 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithEpilogueModel = ArgumentModel<e_a_type,
+                                                     e_compute_type,
+                                                     e_transA,
+                                                     e_transB,
+                                                     e_M,
+                                                     e_N,
+                                                     e_K,
+                                                     e_alpha,
+                                                     e_lda,
+                                                     e_ldb,
+                                                     e_beta,
+                                                     e_ldc,
+                                                     e_activation>;
+
+inline void testname_gemm_ex_with_epilogue(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithEpilogueModel{}.test_name(arg, name);
+}
+
+// Epilogues that are inconsistent, or whose scale cannot be folded into alpha and beta, are
+// rejected before any work is done
+template <typename T>
+void testing_gemm_ex_with_epilogue_bad_arg(const Arguments& arg)
+{
+    const int M = 10, N = 11, K = 12, lda = 10, ldb = 12, ldc = 10;
+
+    hipDataType          type         = hipblas_hip_datatype<T>;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    T alpha = T(1), beta = T(0), scale = T(2), negative_scale = T(-1);
+
+    device_vector<T> dA(size_t(lda) * K);
+    device_vector<T> dB(size_t(ldb) * N);
+    device_vector<T> dC(size_t(ldc) * N);
+    device_vector<T> d_bias(M);
+    device_vector<T> d_aux(size_t(ldc) * N);
+
+    hipblasLocalHandle handle(arg);
+    ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    hipblasGemmEpilogue_t epilogue = {};
+
+    auto gemm_epilogue = [&]() {
+        return hipblasGemmExWithEpilogue(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         M,
+                                         N,
+                                         K,
+                                         &alpha,
+                                         dA,
+                                         type,
+                                         lda,
+                                         dB,
+                                         type,
+                                         ldb,
+                                         &beta,
+                                         dC,
+                                         type,
+                                         ldc,
+                                         &epilogue,
+                                         compute_type,
+                                         HIPBLAS_GEMM_DEFAULT);
+    };
+
+    // invalid activation
+    epilogue.activation = hipblasActivationType_t(3);
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_INVALID_ENUM);
+
+    // aux holds the values before activation, so it needs an activation
+    epilogue.activation = HIPBLAS_ACTIVATION_NONE;
+    epilogue.aux        = d_aux;
+    epilogue.ldaux      = ldc;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_INVALID_VALUE);
+    epilogue.activation = HIPBLAS_ACTIVATION_GELU;
+    epilogue.ldaux      = M - 1;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // scale with aux, a bias or GELU cannot be folded into alpha and beta
+    epilogue.ldaux = ldc;
+    epilogue.scale = &scale;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_NOT_SUPPORTED);
+    epilogue.aux = nullptr;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_NOT_SUPPORTED);
+    epilogue.activation = HIPBLAS_ACTIVATION_NONE;
+    epilogue.bias       = d_bias;
+    epilogue.biasType   = type;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_NOT_SUPPORTED);
+    epilogue.activation = HIPBLAS_ACTIVATION_RELU;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // ReLU commutes with a positive scale only
+    epilogue.bias  = nullptr;
+    epilogue.scale = &negative_scale;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_NOT_SUPPORTED);
+    epilogue.scale = &scale;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_SUCCESS);
+
+    epilogue.activation = HIPBLAS_ACTIVATION_NONE;
+    epilogue.scale      = &negative_scale;
+    EXPECT_HIPBLAS_STATUS2(gemm_epilogue(), HIPBLAS_STATUS_SUCCESS);
+}
+
+template <typename T>
+hipblasStatus_t testing_gemm_ex_with_epilogue_bad_arg_ret(const Arguments& arg)
+{
+    testing_gemm_ex_with_epilogue_bad_arg<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The epilogue is tested twice. The first adds a bias to each column of the result and
+// applies arg.activation; with GELU the values before activation are also written to an aux
+// matrix. Without GELU, the second scales the result instead of adding a bias, as the scale
+// is supported only where it can be folded into alpha and beta.
+template <typename T>
+void testing_gemm_ex_with_epilogue(const Arguments& arg)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    hipDataType             type         = hipblas_hip_datatype<T>;
+    hipblasComputeType_t    compute_type = arg.compute_type_gemm;
+    hipblasActivationType_t activation   = hipblasActivationType_t(arg.activation);
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+    T h_scale = T(2);
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> h_bias(M);
+    host_vector<T> hC(size_C);
+    host_vector<T> hC_host(size_C);
+    host_vector<T> hC_device(size_C);
+    host_vector<T> hC_gold(size_C);
+    host_vector<T> h_aux_host(size_C);
+    host_vector<T> h_aux_device(size_C);
+    host_vector<T> h_aux_gold(size_C);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> d_bias(M);
+    device_vector<T> dC(size_C);
+    device_vector<T> d_aux(size_C);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    device_vector<T> d_scale(1);
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_vector(h_bias, arg, M, 1, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+    // copy data from CPU to device
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_bias, h_bias, sizeof(T) * M, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(d_scale, &h_scale, sizeof(T), hipMemcpyHostToDevice));
+
+    hipblasGemmEpilogue_t epilogue = {};
+    epilogue.biasType              = type;
+    epilogue.activation            = activation;
+    epilogue.ldaux                 = ldc;
+
+    auto gemm_epilogue = [&](const T* alpha, const T* beta) {
+        return hipblasGemmExWithEpilogue(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         type,
+                                         lda,
+                                         dB,
+                                         type,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         type,
+                                         ldc,
+                                         &epilogue,
+                                         compute_type,
+                                         algo);
+    };
+
+    if(unit_check || norm_check)
+    {
+        for(bool scaled : {false, true})
+        {
+            if(scaled && activation == HIPBLAS_ACTIVATION_GELU)
+                continue;
+
+            bool with_aux = !scaled && activation == HIPBLAS_ACTIVATION_GELU;
+            T    scale    = scaled ? h_scale : T(1);
+
+            epilogue.bias = scaled ? nullptr : (T*)d_bias;
+            epilogue.aux  = with_aux ? (T*)d_aux : nullptr;
+            hC_gold       = hC;
+
+            // hipBLAS
+            ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC, sizeof(T) * size_C, hipMemcpyHostToDevice));
+            ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            epilogue.scale = scaled ? &h_scale : nullptr;
+            ASSERT_HIPBLAS_SUCCESS(gemm_epilogue(&h_alpha, &h_beta));
+
+            ASSERT_HIP_SUCCESS(hipMemcpy(hC_host, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+            ASSERT_HIP_SUCCESS(
+                hipMemcpy(h_aux_host, d_aux, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+            ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC, sizeof(T) * size_C, hipMemcpyHostToDevice));
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            epilogue.scale = scaled ? (T*)d_scale : nullptr;
+            ASSERT_HIPBLAS_SUCCESS(gemm_epilogue(d_alpha, d_beta));
+
+            ASSERT_HIP_SUCCESS(
+                hipMemcpy(hC_device, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+            ASSERT_HIP_SUCCESS(
+                hipMemcpy(h_aux_device, d_aux, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+            // reference BLAS followed by the epilogue
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data(),
+                          lda,
+                          hB.data(),
+                          ldb,
+                          h_beta,
+                          hC_gold.data(),
+                          ldc);
+
+            const T sqrt_2_over_pi = T(0.7978845608028654);
+            for(int j = 0; j < N; j++)
+            {
+                for(int i = 0; i < M; i++)
+                {
+                    size_t idx = i + size_t(j) * ldc;
+                    T      x   = scaled ? hC_gold[idx] : hC_gold[idx] + h_bias[i];
+
+                    h_aux_gold[idx] = x;
+                    if(activation == HIPBLAS_ACTIVATION_RELU)
+                        x = std::max(x, T(0));
+                    else if(activation == HIPBLAS_ACTIVATION_GELU)
+                        x = T(0.5) * x
+                            * (T(1) + std::tanh(sqrt_2_over_pi * (x + T(0.044715) * x * x * x)));
+                    hC_gold[idx] = scale * x;
+                }
+            }
+
+            // GELU evaluates tanh, which is not exact on the device
+            const double tol = K * hipblas_type_epsilon<T>;
+            if(unit_check)
+            {
+                if(activation == HIPBLAS_ACTIVATION_GELU)
+                {
+                    near_check_general<T>(M, N, ldc, hC_gold.data(), hC_host.data(), tol);
+                    near_check_general<T>(M, N, ldc, hC_gold.data(), hC_device.data(), tol);
+                }
+                else
+                {
+                    unit_check_general<T>(M, N, ldc, hC_gold, hC_host);
+                    unit_check_general<T>(M, N, ldc, hC_gold, hC_device);
+                }
+                if(with_aux)
+                {
+                    unit_check_general<T>(M, N, ldc, h_aux_gold, h_aux_host);
+                    unit_check_general<T>(M, N, ldc, h_aux_gold, h_aux_device);
+                }
+            }
+            if(norm_check)
+            {
+                hipblas_error_host = std::max(
+                    hipblas_error_host,
+                    std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_host)));
+                hipblas_error_device = std::max(
+                    hipblas_error_device,
+                    std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_device)));
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        epilogue.bias  = d_bias;
+        epilogue.aux   = activation == HIPBLAS_ACTIVATION_GELU ? (T*)d_aux : nullptr;
+        epilogue.scale = nullptr;
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(gemm_epilogue(&h_alpha, &h_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmExWithEpilogueModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     gemm_gflop_count<T>(M, N, K),
+                                                     gemm_gbyte_count<T>(M, N, K),
+                                                     hipblas_error_host,
+                                                     hipblas_error_device);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_gemm_ex_with_epilogue_ret(const Arguments& arg)
+{
+    testing_gemm_ex_with_epilogue<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
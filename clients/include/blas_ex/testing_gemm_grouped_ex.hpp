@@ -0,0 +1,379 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmGroupedExModel = ArgumentModel<e_a_type,
+                                                e_c_type,
+                                                e_compute_type,
+                                                e_transA,
+                                                e_transB,
+                                                e_M,
+                                                e_N,
+                                                e_K,
+                                                e_alpha,
+                                                e_lda,
+                                                e_ldb,
+                                                e_beta,
+                                                e_ldc,
+                                                e_batch_count,
+                                                e_group_count>;
+
+inline void testname_gemm_grouped_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedExModel{}.test_name(arg, name);
+}
+
+// Every group is checked before any group is computed, so an invalid argument in the
+// last group, including an empty one, fails the whole call
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_ex_bad_arg(const Arguments& arg)
+{
+    const int            group_count  = 2;
+    hipDataType          a_type       = hipblas_hip_datatype<Ti>;
+    hipDataType          c_type       = hipblas_hip_datatype<To>;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    // The second group is empty, so its leading dimensions are only bounded below by 1
+    std::vector<hipblasOperation_t> transA(group_count, HIPBLAS_OP_N);
+    std::vector<hipblasOperation_t> transB(group_count, HIPBLAS_OP_N);
+    std::vector<int>                m{10, 0}, n{11, 0}, k{12, 0}, lda{10, 1}, ldb{12, 1},
+        ldc{10, 1}, group_size{1, 1};
+    std::vector<Tex> alpha(group_count, Tex(1)), beta(group_count, Tex(0));
+
+    device_batch_vector<Ti> dA(size_t(lda[0]) * k[0], 1, group_count);
+    device_batch_vector<Ti> dB(size_t(ldb[0]) * n[0], 1, group_count);
+    device_batch_vector<To> dC(size_t(ldc[0]) * n[0], 1, group_count);
+    ASSERT_HIP_SUCCESS(dA.memcheck());
+    ASSERT_HIP_SUCCESS(dB.memcheck());
+    ASSERT_HIP_SUCCESS(dC.memcheck());
+
+    hipblasLocalHandle handle(arg);
+    ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto gemm_grouped = [&]() {
+        return hipblasGemmGroupedEx(handle,
+                                    transA.data(),
+                                    transB.data(),
+                                    m.data(),
+                                    n.data(),
+                                    k.data(),
+                                    alpha.data(),
+                                    (const void**)(Ti**)dA.ptr_on_device(),
+                                    a_type,
+                                    lda.data(),
+                                    (const void**)(Ti**)dB.ptr_on_device(),
+                                    a_type,
+                                    ldb.data(),
+                                    beta.data(),
+                                    (void**)(To**)dC.ptr_on_device(),
+                                    c_type,
+                                    ldc.data(),
+                                    group_count,
+                                    group_size.data(),
+                                    compute_type,
+                                    HIPBLAS_GEMM_DEFAULT);
+    };
+
+    EXPECT_HIPBLAS_STATUS2(gemm_grouped(), HIPBLAS_STATUS_SUCCESS);
+
+    // invalid operations
+    transA[1] = hipblasOperation_t(0);
+    EXPECT_HIPBLAS_STATUS2(gemm_grouped(), HIPBLAS_STATUS_INVALID_ENUM);
+    transA[1] = HIPBLAS_OP_N;
+    transB[1] = hipblasOperation_t(HIPBLAS_FILL_MODE_FULL);
+    EXPECT_HIPBLAS_STATUS2(gemm_grouped(), HIPBLAS_STATUS_INVALID_ENUM);
+    transB[1] = HIPBLAS_OP_N;
+
+    // leading dimensions of 0 for the empty group
+    for(std::vector<int>* ld : {&lda, &ldb, &ldc})
+    {
+        (*ld)[1] = 0;
+        EXPECT_HIPBLAS_STATUS2(gemm_grouped(), HIPBLAS_STATUS_INVALID_VALUE);
+        (*ld)[1] = 1;
+    }
+
+    // leading dimensions smaller than the rows of a non-empty group
+    for(std::vector<int>* ld : {&lda, &ldb, &ldc})
+    {
+        (*ld)[0]--;
+        EXPECT_HIPBLAS_STATUS2(gemm_grouped(), HIPBLAS_STATUS_INVALID_VALUE);
+        (*ld)[0]++;
+    }
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+hipblasStatus_t testing_gemm_grouped_ex_bad_arg_ret(const Arguments& arg)
+{
+    testing_gemm_grouped_ex_bad_arg<Ti, To, Tex>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Group g of the test has sizes M + g, N + g and K + g, leading dimensions lda + g,
+// ldb + g and ldc + g, and batch_count matrix products. Odd groups swap alpha and beta,
+// so that each group reads its own scalars.
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_ex(const Arguments& arg)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M = arg.M;
+    int N = arg.N;
+    int K = arg.K;
+
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    int batch_count = arg.batch_count;
+    int group_count = arg.group_count;
+
+    hipDataType          a_type       = hipblas_hip_datatype<Ti>;
+    hipDataType          c_type       = hipblas_hip_datatype<To>;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0
+       || group_count < 0)
+    {
+        return;
+    }
+
+    std::vector<hipblasOperation_t> h_transA(group_count, transA), h_transB(group_count, transB);
+    std::vector<int> h_m(group_count), h_n(group_count), h_k(group_count), h_lda(group_count),
+        h_ldb(group_count), h_ldc(group_count), h_group_size(group_count, batch_count);
+    std::vector<Tex> h_alpha(group_count), h_beta(group_count);
+
+    size_t size_A = 1, size_B = 1, size_C = 1;
+    double gflops = 0, gbytes = 0;
+    for(int g = 0; g < group_count; g++)
+    {
+        h_m[g]     = M + g;
+        h_n[g]     = N + g;
+        h_k[g]     = K + g;
+        h_lda[g]   = lda + g;
+        h_ldb[g]   = ldb + g;
+        h_ldc[g]   = ldc + g;
+        h_alpha[g] = g % 2 ? h_beta_Tex : h_alpha_Tex;
+        h_beta[g]  = g % 2 ? h_alpha_Tex : h_beta_Tex;
+
+        size_t A_col = transA == HIPBLAS_OP_N ? h_k[g] : h_m[g];
+        size_t B_col = transB == HIPBLAS_OP_N ? h_n[g] : h_k[g];
+        size_A       = std::max(size_A, size_t(h_lda[g]) * A_col);
+        size_B       = std::max(size_B, size_t(h_ldb[g]) * B_col);
+        size_C       = std::max(size_C, size_t(h_ldc[g]) * h_n[g]);
+
+        gflops += gemm_gflop_count<Tex>(h_m[g], h_n[g], h_k[g]);
+        gbytes += gemm_gbyte_count<Tex>(h_m[g], h_n[g], h_k[g]);
+    }
+
+    // Every matrix is allocated with the size of the largest group
+    int total_count = group_count * batch_count;
+
+    device_batch_vector<Ti> dA(size_A, 1, total_count);
+    device_batch_vector<Ti> dB(size_B, 1, total_count);
+    device_batch_vector<To> dC(size_C, 1, total_count);
+    device_vector<Tex>      d_alpha(std::max(group_count, 1));
+    device_vector<Tex>      d_beta(std::max(group_count, 1));
+
+    ASSERT_HIP_SUCCESS(dA.memcheck());
+    ASSERT_HIP_SUCCESS(dB.memcheck());
+    ASSERT_HIP_SUCCESS(dC.memcheck());
+
+    host_batch_vector<Ti> hA(size_A, 1, total_count);
+    host_batch_vector<Ti> hB(size_B, 1, total_count);
+    host_batch_vector<To> hC_host(size_C, 1, total_count);
+    host_batch_vector<To> hC_device(size_C, 1, total_count);
+    host_batch_vector<To> hC_gold(size_C, 1, total_count);
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_vector(hA, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hB, arg, hipblas_client_alpha_sets_nan);
+    hipblas_init_vector(hC_host, arg, hipblas_client_beta_sets_nan);
+
+    hC_device.copy_from(hC_host);
+    hC_gold.copy_from(hC_host);
+
+    ASSERT_HIP_SUCCESS(dA.transfer_from(hA));
+    ASSERT_HIP_SUCCESS(dB.transfer_from(hB));
+    ASSERT_HIP_SUCCESS(dC.transfer_from(hC_host));
+    ASSERT_HIP_SUCCESS(
+        hipMemcpy(d_alpha, h_alpha.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(
+        hipMemcpy(d_beta, h_beta.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+
+    auto gemm_grouped = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasGemmGroupedEx(handle,
+                                    h_transA.data(),
+                                    h_transB.data(),
+                                    h_m.data(),
+                                    h_n.data(),
+                                    h_k.data(),
+                                    alpha,
+                                    (const void**)(Ti**)dA.ptr_on_device(),
+                                    a_type,
+                                    h_lda.data(),
+                                    (const void**)(Ti**)dB.ptr_on_device(),
+                                    a_type,
+                                    h_ldb.data(),
+                                    beta,
+                                    (void**)(To**)dC.ptr_on_device(),
+                                    c_type,
+                                    h_ldc.data(),
+                                    group_count,
+                                    h_group_size.data(),
+                                    compute_type,
+                                    algo);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        ASSERT_HIPBLAS_SUCCESS(gemm_grouped(h_alpha.data(), h_beta.data()));
+
+        ASSERT_HIP_SUCCESS(hC_host.transfer_from(dC));
+        ASSERT_HIP_SUCCESS(dC.transfer_from(hC_device));
+
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        ASSERT_HIPBLAS_SUCCESS(gemm_grouped(d_alpha, d_beta));
+
+        ASSERT_HIP_SUCCESS(hC_device.transfer_from(dC));
+
+        // CPU BLAS
+        for(int g = 0; g < group_count; g++)
+        {
+            for(int b = g * batch_count; b < (g + 1) * batch_count; b++)
+            {
+                cblas_gemm<Ti, To, Tex>(transA,
+                                        transB,
+                                        h_m[g],
+                                        h_n[g],
+                                        h_k[g],
+                                        h_alpha[g],
+                                        hA[b],
+                                        h_lda[g],
+                                        hB[b],
+                                        h_ldb[g],
+                                        h_beta[g],
+                                        hC_gold[b],
+                                        h_ldc[g]);
+            }
+        }
+
+        for(int g = 0; g < group_count; g++)
+        {
+            To** gold   = (To**)hC_gold + g * batch_count;
+            To** host   = (To**)hC_host + g * batch_count;
+            To** device = (To**)hC_device + g * batch_count;
+
+            if(unit_check)
+            {
+                // check for float16/bfloat16 input
+                if((getArchMajor() == 11)
+                   && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                       || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                       || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
+                {
+                    const double tol = h_k[g] * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+                    near_check_general<To>(h_m[g], h_n[g], batch_count, h_ldc[g], gold, host, tol);
+                    near_check_general<To>(
+                        h_m[g], h_n[g], batch_count, h_ldc[g], gold, device, tol);
+                }
+                else
+                {
+                    unit_check_general<To>(h_m[g], h_n[g], batch_count, h_ldc[g], gold, host);
+                    unit_check_general<To>(h_m[g], h_n[g], batch_count, h_ldc[g], gold, device);
+                }
+            }
+
+            if(norm_check)
+            {
+                for(int b = 0; b < batch_count; b++)
+                {
+                    hipblas_error_host += norm_check_general<To>(
+                        'F', h_m[g], h_n[g], h_ldc[g], gold[b], host[b]);
+                    hipblas_error_device += norm_check_general<To>(
+                        'F', h_m[g], h_n[g], h_ldc[g], gold[b], device[b]);
+                }
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+        ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(gemm_grouped(h_alpha.data(), h_beta.data()));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmGroupedExModel{}.log_args<To>(std::cout,
+                                                 arg,
+                                                 gpu_time_used,
+                                                 gflops,
+                                                 gbytes,
+                                                 hipblas_error_host,
+                                                 hipblas_error_device);
+    }
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+hipblasStatus_t testing_gemm_grouped_ex_ret(const Arguments& arg)
+{
+    testing_gemm_grouped_ex<Ti, To, Tex>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -49,7 +49,8 @@ using hipblasGemmStridedBatchedExModel = ArgumentModel<e_a_type,
                                                        e_stride_scale,
                                                        e_batch_count,
                                                        e_with_flags,
-                                                       e_flags>;
+                                                       e_flags,
+                                                       e_with_scalar_arrays>;
 // strides not logged
 
 inline void testname_gemm_strided_batched_ex(const Arguments& arg, std::string& name)
@@ -120,7 +121,16 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     device_vector<Tex> d_alpha(1);
     device_vector<Tex> d_beta(1);
 
-    if(!dA || !dB || !dC || !d_alpha || !d_beta)
+    // One alpha and beta for each batch, for the WithScalarArrays variant which takes
+    // hipDataType with or without HIPBLAS_V2
+    hipDataType        a_hip_type = hipblas_hip_datatype<Ti>;
+    hipDataType        c_hip_type = hipblas_hip_datatype<To>;
+    host_vector<Tex>   h_alpha(batch_count);
+    host_vector<Tex>   h_beta(batch_count);
+    device_vector<Tex> d_alpha_array(std::max(batch_count, 1));
+    device_vector<Tex> d_beta_array(std::max(batch_count, 1));
+
+    if(!dA || !dB || !dC || !d_alpha || !d_beta || !d_alpha_array || !d_beta_array)
     {
         PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
         return;
@@ -144,6 +154,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     hipblas_init_matrix(
         hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
     hC_gold = hC_device = hC_host;
+    hipblas_init_batch_scalars(h_alpha, h_beta, arg, batch_count);
 
     // copy data from CPU to device
     ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
@@ -152,12 +163,43 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC_host, sizeof(To) * size_C, hipMemcpyHostToDevice));
     ASSERT_HIP_SUCCESS(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
     ASSERT_HIP_SUCCESS(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(
+        hipMemcpy(d_alpha_array, h_alpha, sizeof(Tex) * batch_count, hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(
+        hipMemcpy(d_beta_array, h_beta, sizeof(Tex) * batch_count, hipMemcpyHostToDevice));
 
     if(unit_check || norm_check)
     {
         // hipBLAS
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        if(!arg.with_flags)
+        if(arg.with_scalar_arrays)
+        {
+            ASSERT_HIPBLAS_SUCCESS(
+                hipblasGemmStridedBatchedExWithScalarArrays(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            h_alpha,
+                                                            dA,
+                                                            a_hip_type,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            a_hip_type,
+                                                            ldb,
+                                                            stride_B,
+                                                            h_beta,
+                                                            dC,
+                                                            c_hip_type,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            compute_type_gemm,
+                                                            algo));
+        }
+        else if(!arg.with_flags)
         {
             ASSERT_HIPBLAS_SUCCESS(hipblasGemmStridedBatchedExFn(handle,
                                                                  transA,
@@ -223,7 +265,34 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC_device, sizeof(To) * size_C, hipMemcpyHostToDevice));
 
         ASSERT_HIPBLAS_SUCCESS(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        if(!arg.with_flags)
+        if(arg.with_scalar_arrays)
+        {
+            ASSERT_HIPBLAS_SUCCESS(
+                hipblasGemmStridedBatchedExWithScalarArrays(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            d_alpha_array,
+                                                            dA,
+                                                            a_hip_type,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            a_hip_type,
+                                                            ldb,
+                                                            stride_B,
+                                                            d_beta_array,
+                                                            dC,
+                                                            c_hip_type,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            compute_type_gemm,
+                                                            algo));
+        }
+        else if(!arg.with_flags)
         {
             ASSERT_HIPBLAS_SUCCESS(hipblasGemmStridedBatchedExFn(handle,
                                                                  transA,
@@ -288,22 +357,23 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         ASSERT_HIP_SUCCESS(hipMemcpy(hC_device, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
 
         // CPU BLAS
-        for(int b = 0; b < batch_count; b++)
-        {
-            cblas_gemm<Ti, To, Tex>(transA,
-                                    transB,
-                                    M,
-                                    N,
-                                    K,
-                                    h_alpha_Tex,
-                                    hA.data() + b * stride_A,
-                                    lda,
-                                    hB.data() + b * stride_B,
-                                    ldb,
-                                    h_beta_Tex,
-                                    hC_gold.data() + b * stride_C,
-                                    ldc);
-        }
+        cblas_gemm_strided_batched<Ti, To, Tex>(transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                h_alpha,
+                                                hA,
+                                                lda,
+                                                stride_A,
+                                                hB,
+                                                ldb,
+                                                stride_B,
+                                                h_beta,
+                                                hC_gold,
+                                                ldc,
+                                                stride_C,
+                                                batch_count);
 
         if(unit_check)
         {
@@ -344,7 +414,34 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            if(!arg.with_flags)
+            if(arg.with_scalar_arrays)
+            {
+                ASSERT_HIPBLAS_SUCCESS(
+                    hipblasGemmStridedBatchedExWithScalarArrays(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                h_alpha,
+                                                                dA,
+                                                                a_hip_type,
+                                                                lda,
+                                                                stride_A,
+                                                                dB,
+                                                                a_hip_type,
+                                                                ldb,
+                                                                stride_B,
+                                                                h_beta,
+                                                                dC,
+                                                                c_hip_type,
+                                                                ldc,
+                                                                stride_C,
+                                                                batch_count,
+                                                                compute_type_gemm,
+                                                                algo));
+            }
+            else if(!arg.with_flags)
             {
                 ASSERT_HIPBLAS_SUCCESS(hipblasGemmStridedBatchedExFn(handle,
                                                                      transA,
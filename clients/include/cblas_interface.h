@@ -199,6 +199,10 @@ void cblas_symv(
 template <typename T>
 int cblas_potrf(char uplo, int m, T* A, int lda);
 
+// potrs
+template <typename T>
+int cblas_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
 // tbmv
 template <typename T>
 void cblas_tbmv(hipblasFillMode_t  uplo,
@@ -345,6 +349,42 @@ void cblas_gemm(hipblasOperation_t transA,
                 To*                C,
                 int                ldc);
 
+// gemm_strided_batched with alpha and beta arrays holding one scalar per batch
+template <typename Ti, typename To = Ti, typename Tc = To>
+void cblas_gemm_strided_batched(hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const Tc*          alpha,
+                                Ti*                A,
+                                int                lda,
+                                hipblasStride      stride_a,
+                                Ti*                B,
+                                int                ldb,
+                                hipblasStride      stride_b,
+                                const Tc*          beta,
+                                To*                C,
+                                int                ldc,
+                                hipblasStride      stride_c,
+                                int                batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        cblas_gemm<Ti, To, Tc>(transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               alpha[b],
+                               A + b * stride_a,
+                               lda,
+                               B + b * stride_b,
+                               ldb,
+                               beta[b],
+                               C + b * stride_c,
+                               ldc);
+}
+
 // hemm
 template <typename T>
 void cblas_hemm(hipblasSideMode_t side,
@@ -462,6 +502,21 @@ int cblas_getri(int n, T* A, int lda, int* ipiv, T* work, int lwork);
 template <typename T>
 int cblas_geqrf(int m, int n, T* A, int lda, T* tau, T* work, int lwork);
 
+// ormqr for real types, unmqr for complex types
+template <typename T>
+int cblas_ormqr(char side,
+                char trans,
+                int  m,
+                int  n,
+                int  k,
+                T*   A,
+                int  lda,
+                T*   tau,
+                T*   C,
+                int  ldc,
+                T*   work,
+                int  lwork);
+
 template <typename T>
 int cblas_gels(
     char trans, int m, int n, int nrhs, T* A, int lda, T* B, int ldb, T* work, int lwork);
@@ -345,6 +345,37 @@ hipblasStatus_t hipblasAxpyStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   stridey,
                                           int             batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasAxpy_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const T*        alpha,
+                               const T*        x,
+                               int64_t         incx,
+                               T*              y,
+                               int64_t         incy);
+
+template <typename T>
+hipblasStatus_t hipblasAxpyBatched_64(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const T*        alpha,
+                                      const T* const  x[],
+                                      int64_t         incx,
+                                      T* const        y[],
+                                      int64_t         incy,
+                                      int64_t         batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasAxpyStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             const T*        alpha,
+                                             const T*        x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             T*              y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batch_count);
+
 // ger
 template <typename T, bool CONJ, bool FORTRAN = false>
 hipblasStatus_t hipblasGer(hipblasHandle_t handle,
@@ -1300,6 +1331,22 @@ hipblasStatus_t hipblasGemm(hipblasHandle_t    handle,
                             T*                 C,
                             int                ldc);
 
+template <typename T>
+hipblasStatus_t hipblasGemm_64(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int64_t            m,
+                               int64_t            n,
+                               int64_t            k,
+                               const T*           alpha,
+                               const T*           A,
+                               int64_t            lda,
+                               const T*           B,
+                               int64_t            ldb,
+                               const T*           beta,
+                               T*                 C,
+                               int64_t            ldc);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGemmStridedBatched(hipblasHandle_t    handle,
                                           hipblasOperation_t transA,
@@ -1320,6 +1367,26 @@ hipblasStatus_t hipblasGemmStridedBatched(hipblasHandle_t    handle,
                                           int                bsc,
                                           int                batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasGemmStridedBatchedWithScalarArrays(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transA,
+                                                          hipblasOperation_t transB,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const T*           alpha,
+                                                          const T*           A,
+                                                          int                lda,
+                                                          int                bsa,
+                                                          const T*           B,
+                                                          int                ldb,
+                                                          int                bsb,
+                                                          const T*           beta,
+                                                          T*                 C,
+                                                          int                ldc,
+                                                          int                bsc,
+                                                          int                batch_count);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGemmBatched(hipblasHandle_t    handle,
                                    hipblasOperation_t transA,
@@ -1731,6 +1798,159 @@ hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t    handle,
                                           hipblasStride      strideC,
                                           int                batchCount);
 
+// gemm_row_major
+template <typename T>
+hipblasStatus_t hipblasGemmRowMajor(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           B,
+                                    int                ldb,
+                                    const T*           beta,
+                                    T*                 C,
+                                    int                ldc);
+
+// gemv_row_major
+template <typename T>
+hipblasStatus_t hipblasGemvRowMajor(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                m,
+                                    int                n,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           x,
+                                    int                incx,
+                                    const T*           beta,
+                                    T*                 y,
+                                    int                incy);
+
+// trsm_row_major
+template <typename T>
+hipblasStatus_t hipblasTrsmRowMajor(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    int                m,
+                                    int                n,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    T*                 B,
+                                    int                ldb);
+
+// syrk_row_major
+template <typename T>
+hipblasStatus_t hipblasSyrkRowMajor(hipblasHandle_t    handle,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    int                n,
+                                    int                k,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           beta,
+                                    T*                 C,
+                                    int                ldc);
+
+// geam_row_major
+template <typename T>
+hipblasStatus_t hipblasGeamRowMajor(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                m,
+                                    int                n,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           beta,
+                                    const T*           B,
+                                    int                ldb,
+                                    T*                 C,
+                                    int                ldc);
+
+// omatcopy
+template <typename T>
+hipblasStatus_t hipblasOmatcopy(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                rows,
+                                int                cols,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                T*                 B,
+                                int                ldb);
+
+// omatcopy_batched
+template <typename T>
+hipblasStatus_t hipblasOmatcopyBatched(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int                rows,
+                                       int                cols,
+                                       const T*           alpha,
+                                       const T* const     A[],
+                                       int                lda,
+                                       T* const           B[],
+                                       int                ldb,
+                                       int                batchCount);
+
+// omatcopy_strided_batched
+template <typename T>
+hipblasStatus_t hipblasOmatcopyStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int                rows,
+                                              int                cols,
+                                              const T*           alpha,
+                                              const T*           A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              T*                 B,
+                                              int                ldb,
+                                              hipblasStride      strideB,
+                                              int                batchCount);
+
+// imatcopy
+template <typename T>
+hipblasStatus_t hipblasImatcopy(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                rows,
+                                int                cols,
+                                const T*           alpha,
+                                T*                 AB,
+                                int                lda,
+                                int                ldb);
+
+// imatcopy_batched
+template <typename T>
+hipblasStatus_t hipblasImatcopyBatched(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int                rows,
+                                       int                cols,
+                                       const T*           alpha,
+                                       T* const           AB[],
+                                       int                lda,
+                                       int                ldb,
+                                       int                batchCount);
+
+// imatcopy_strided_batched
+template <typename T>
+hipblasStatus_t hipblasImatcopyStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int                rows,
+                                              int                cols,
+                                              const T*           alpha,
+                                              T*                 AB,
+                                              int                lda,
+                                              int                ldb,
+                                              hipblasStride      stride,
+                                              int                batchCount);
+
 // hemm
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasHemm(hipblasHandle_t   handle,
@@ -1962,6 +2182,30 @@ hipblasStatus_t hipblasGetriBatched(hipblasHandle_t handle,
                                     int*            info,
                                     const int       batchCount);
 
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetri(hipblasHandle_t handle,
+                             const int       n,
+                             T*              A,
+                             const int       lda,
+                             int*            ipiv,
+                             T*              C,
+                             const int       ldc,
+                             int*            info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetriStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           T*                  A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           T*                  C,
+                                           const int           ldc,
+                                           const hipblasStride strideC,
+                                           int*                info,
+                                           const int           batchCount);
+
 // geqrf
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGeqrf(
@@ -1989,6 +2233,53 @@ hipblasStatus_t hipblasGeqrfStridedBatched(hipblasHandle_t     handle,
                                            int*                info,
                                            const int           batchCount);
 
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasOrmqr(hipblasHandle_t    handle,
+                             hipblasSideMode_t  side,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          k,
+                             T*                 A,
+                             const int          lda,
+                             T*                 ipiv,
+                             T*                 C,
+                             const int          ldc,
+                             int*               info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasOrmqrBatched(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          k,
+                                    T* const           A[],
+                                    const int          lda,
+                                    T* const           ipiv[],
+                                    T* const           C[],
+                                    const int          ldc,
+                                    int*               info,
+                                    const int          batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasOrmqrStridedBatched(hipblasHandle_t     handle,
+                                           hipblasSideMode_t   side,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           k,
+                                           T*                  A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           T*                  ipiv,
+                                           const hipblasStride strideP,
+                                           T*                  C,
+                                           const int           ldc,
+                                           const hipblasStride strideC,
+                                           int*                info,
+                                           const int           batchCount);
+
 // gels
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGels(hipblasHandle_t    handle,
@@ -2033,6 +2324,102 @@ hipblasStatus_t hipblasGelsStridedBatched(hipblasHandle_t     handle,
                                           int*                deviceInfo,
                                           const int           batchCount);
 
+// potrf
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrf(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             T*                      A,
+                             const int               lda,
+                             int*                    info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrfBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrfStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// potrs
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrs(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             const int               nrhs,
+                             T*                      A,
+                             const int               lda,
+                             T*                      B,
+                             const int               ldb,
+                             int*                    info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrsBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T* const                A[],
+                                    const int               lda,
+                                    T* const                B[],
+                                    const int               ldb,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrsStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           T*                      B,
+                                           const int               ldb,
+                                           const hipblasStride     strideB,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// gesv
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvBatched(hipblasHandle_t handle,
+                                   const int       n,
+                                   const int       nrhs,
+                                   T* const        A[],
+                                   const int       lda,
+                                   int*            ipiv,
+                                   T* const        B[],
+                                   const int       ldb,
+                                   int*            info,
+                                   int*            deviceInfo,
+                                   const int       batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvStridedBatched(hipblasHandle_t     handle,
+                                          const int           n,
+                                          const int           nrhs,
+                                          T*                  A,
+                                          const int           lda,
+                                          const hipblasStride strideA,
+                                          int*                ipiv,
+                                          const hipblasStride strideP,
+                                          T*                  B,
+                                          const int           ldb,
+                                          const hipblasStride strideB,
+                                          int*                info,
+                                          int*                deviceInfo,
+                                          const int           batchCount);
+
 // dgmm
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasDgmm(hipblasHandle_t   handle,
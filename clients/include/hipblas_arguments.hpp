@@ -60,6 +60,7 @@ typedef enum hipblas_client_api_
 {
     C,
     FORTRAN,
+    C_64, // _64 functions taking int64_t sizes
 } hipblas_client_api;
 
 // conversion helpers
@@ -99,19 +100,19 @@ struct Arguments
 {
     // if you add or reorder members you must update FOR_EACH_ARGUMENT macro
 
-    int M  = 128;
-    int N  = 128;
-    int K  = 128;
-    int KL = 128;
-    int KU = 128;
+    int64_t M  = 128;
+    int64_t N  = 128;
+    int64_t K  = 128;
+    int64_t KL = 128;
+    int64_t KU = 128;
 
-    int rows = 128;
-    int cols = 128;
+    int64_t rows = 128;
+    int64_t cols = 128;
 
-    int lda = 128;
-    int ldb = 128;
-    int ldc = 128;
-    int ldd = 128;
+    int64_t lda = 128;
+    int64_t ldb = 128;
+    int64_t ldc = 128;
+    int64_t ldd = 128;
 
     hipblasDatatype_t a_type = HIPBLAS_R_32F;
     hipblasDatatype_t b_type = HIPBLAS_R_32F;
@@ -125,10 +126,10 @@ struct Arguments
     // used for gemmEx with HIPBLAS_V2 define
     hipblasComputeType_t compute_type_gemm = HIPBLAS_COMPUTE_32F;
 
-    int incx = 1;
-    int incy = 1;
-    int incd = 1;
-    int incb = 1;
+    int64_t incx = 1;
+    int64_t incy = 1;
+    int64_t incd = 1;
+    int64_t incb = 1;
 
     double        stride_scale = 1.0;
     hipblasStride stride_a; //  stride_a > transA == 'N' ? lda * K : lda * M
@@ -154,11 +155,14 @@ struct Arguments
     char diag   = 'N';
 
     int apiCallCount = 1;
-    int batch_count  = 10;
+    int64_t batch_count  = 10;
+    int group_count  = 3;
+    int activation   = HIPBLAS_ACTIVATION_NONE; // only for gemm_ex_with_epilogue
 
-    bool fortran    = false;
-    bool inplace    = false; // only for trmm
-    bool with_flags = false;
+    bool fortran            = false;
+    bool inplace            = false; // only for trmm
+    bool with_flags         = false;
+    bool with_scalar_arrays = false; // alpha and beta hold one scalar per batch
 
     int      norm_check = 0;
     int      unit_check = 1;
@@ -226,9 +230,12 @@ struct Arguments
     OPER(diag) SEP                   \
     OPER(apiCallCount) SEP           \
     OPER(batch_count) SEP            \
+    OPER(group_count) SEP            \
+    OPER(activation) SEP             \
     OPER(fortran) SEP                \
     OPER(inplace) SEP                \
     OPER(with_flags) SEP             \
+    OPER(with_scalar_arrays) SEP     \
     OPER(norm_check) SEP             \
     OPER(unit_check) SEP             \
     OPER(timing) SEP                 \
@@ -7475,6 +7475,623 @@ hipblasStatus_t hipblasZgelsStridedBatchedFortran(hipblasHandle_t       handle,
                                                   int*                  info,
                                                   int*                  deviceInfo,
                                                   const int             batchCount);
+
+// potrf
+hipblasStatus_t hipblasSpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     int*                    info);
+
+// potrfBatched
+hipblasStatus_t hipblasSpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float* const            A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batch_count);
+
+hipblasStatus_t hipblasDpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batch_count);
+
+hipblasStatus_t hipblasCpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batch_count);
+
+hipblasStatus_t hipblasZpotrfBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            int*                        info,
+                                            const int                   batch_count);
+
+// potrfStridedBatched
+hipblasStatus_t hipblasSpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+hipblasStatus_t hipblasDpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+hipblasStatus_t hipblasCpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+hipblasStatus_t hipblasZpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+// potrs
+hipblasStatus_t hipblasSpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float*                  A,
+                                     const int               lda,
+                                     float*                  B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     hipblasComplex*         B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     hipblasDoubleComplex*   B,
+                                     const int               ldb,
+                                     int*                    info);
+
+// potrsBatched
+hipblasStatus_t hipblasSpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float* const            A[],
+                                            const int               lda,
+                                            float* const            B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batch_count);
+
+hipblasStatus_t hipblasDpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double* const           A[],
+                                            const int               lda,
+                                            double* const           B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batch_count);
+
+hipblasStatus_t hipblasCpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            hipblasComplex* const   B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batch_count);
+
+hipblasStatus_t hipblasZpotrsBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            hipblasDoubleComplex* const B[],
+                                            const int                   ldb,
+                                            int*                        info,
+                                            const int                   batch_count);
+
+// potrsStridedBatched
+hipblasStatus_t hipblasSpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   float*                  B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+hipblasStatus_t hipblasDpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+hipblasStatus_t hipblasCpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasComplex*         B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+hipblasStatus_t hipblasZpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasDoubleComplex*   B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batch_count);
+
+// gesvBatched
+hipblasStatus_t hipblasSgesvBatchedFortran(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           float* const    A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           float* const    B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           int*            deviceInfo,
+                                           const int       batch_count);
+
+hipblasStatus_t hipblasDgesvBatchedFortran(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           double* const   A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           int*            deviceInfo,
+                                           const int       batch_count);
+
+hipblasStatus_t hipblasCgesvBatchedFortran(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasComplex* const A[],
+                                           const int             lda,
+                                           int*                  ipiv,
+                                           hipblasComplex* const B[],
+                                           const int             ldb,
+                                           int*                  info,
+                                           int*                  deviceInfo,
+                                           const int             batch_count);
+
+hipblasStatus_t hipblasZgesvBatchedFortran(hipblasHandle_t             handle,
+                                           const int                   n,
+                                           const int                   nrhs,
+                                           hipblasDoubleComplex* const A[],
+                                           const int                   lda,
+                                           int*                        ipiv,
+                                           hipblasDoubleComplex* const B[],
+                                           const int                   ldb,
+                                           int*                        info,
+                                           int*                        deviceInfo,
+                                           const int                   batch_count);
+
+// gesvStridedBatched
+hipblasStatus_t hipblasSgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  float*              A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  float*              B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  int*                deviceInfo,
+                                                  const int           batch_count);
+
+hipblasStatus_t hipblasDgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  double*             A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  int*                deviceInfo,
+                                                  const int           batch_count);
+
+hipblasStatus_t hipblasCgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  hipblasComplex*     A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  hipblasComplex*     B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  int*                deviceInfo,
+                                                  const int           batch_count);
+
+hipblasStatus_t hipblasZgesvStridedBatchedFortran(hipblasHandle_t       handle,
+                                                  const int             n,
+                                                  const int             nrhs,
+                                                  hipblasDoubleComplex* A,
+                                                  const int             lda,
+                                                  const hipblasStride   strideA,
+                                                  int*                  ipiv,
+                                                  const hipblasStride   strideP,
+                                                  hipblasDoubleComplex* B,
+                                                  const int             ldb,
+                                                  const hipblasStride   strideB,
+                                                  int*                  info,
+                                                  int*                  deviceInfo,
+                                                  const int             batch_count);
+
+// getri
+hipblasStatus_t hipblasSgetriFortran(hipblasHandle_t handle,
+                                     const int       n,
+                                     float*          A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     float*          C,
+                                     const int       ldc,
+                                     int*            info);
+
+hipblasStatus_t hipblasDgetriFortran(hipblasHandle_t handle,
+                                     const int       n,
+                                     double*         A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     double*         C,
+                                     const int       ldc,
+                                     int*            info);
+
+hipblasStatus_t hipblasCgetriFortran(hipblasHandle_t handle,
+                                     const int       n,
+                                     hipblasComplex* A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     hipblasComplex* C,
+                                     const int       ldc,
+                                     int*            info);
+
+hipblasStatus_t hipblasZgetriFortran(hipblasHandle_t       handle,
+                                     const int             n,
+                                     hipblasDoubleComplex* A,
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     hipblasDoubleComplex* C,
+                                     const int             ldc,
+                                     int*                  info);
+
+// getriStridedBatched
+hipblasStatus_t hipblasSgetriStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   float*              A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   float*              C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batch_count);
+
+hipblasStatus_t hipblasDgetriStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   double*             A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   double*             C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batch_count);
+
+hipblasStatus_t hipblasCgetriStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   hipblasComplex*     A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   hipblasComplex*     C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batch_count);
+
+hipblasStatus_t hipblasZgetriStridedBatchedFortran(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int             lda,
+                                                   const hipblasStride   strideA,
+                                                   int*                  ipiv,
+                                                   const hipblasStride   strideP,
+                                                   hipblasDoubleComplex* C,
+                                                   const int             ldc,
+                                                   const hipblasStride   strideC,
+                                                   int*                  info,
+                                                   const int             batch_count);
+
+// ormqr
+hipblasStatus_t hipblasSormqrFortran(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasOperation_t trans,
+                                     const int          m,
+                                     const int          n,
+                                     const int          k,
+                                     float*             A,
+                                     const int          lda,
+                                     float*             ipiv,
+                                     float*             C,
+                                     const int          ldc,
+                                     int*               info);
+
+hipblasStatus_t hipblasDormqrFortran(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasOperation_t trans,
+                                     const int          m,
+                                     const int          n,
+                                     const int          k,
+                                     double*            A,
+                                     const int          lda,
+                                     double*            ipiv,
+                                     double*            C,
+                                     const int          ldc,
+                                     int*               info);
+
+hipblasStatus_t hipblasCunmqrFortran(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasOperation_t trans,
+                                     const int          m,
+                                     const int          n,
+                                     const int          k,
+                                     hipblasComplex*    A,
+                                     const int          lda,
+                                     hipblasComplex*    ipiv,
+                                     hipblasComplex*    C,
+                                     const int          ldc,
+                                     int*               info);
+
+hipblasStatus_t hipblasZunmqrFortran(hipblasHandle_t       handle,
+                                     hipblasSideMode_t     side,
+                                     hipblasOperation_t    trans,
+                                     const int             m,
+                                     const int             n,
+                                     const int             k,
+                                     hipblasDoubleComplex* A,
+                                     const int             lda,
+                                     hipblasDoubleComplex* ipiv,
+                                     hipblasDoubleComplex* C,
+                                     const int             ldc,
+                                     int*                  info);
+
+// ormqr_batched
+hipblasStatus_t hipblasSormqrBatchedFortran(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasOperation_t trans,
+                                            const int          m,
+                                            const int          n,
+                                            const int          k,
+                                            float* const       A[],
+                                            const int          lda,
+                                            float* const       ipiv[],
+                                            float* const       C[],
+                                            const int          ldc,
+                                            int*               info,
+                                            const int          batch_count);
+
+hipblasStatus_t hipblasDormqrBatchedFortran(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasOperation_t trans,
+                                            const int          m,
+                                            const int          n,
+                                            const int          k,
+                                            double* const      A[],
+                                            const int          lda,
+                                            double* const      ipiv[],
+                                            double* const      C[],
+                                            const int          ldc,
+                                            int*               info,
+                                            const int          batch_count);
+
+hipblasStatus_t hipblasCunmqrBatchedFortran(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasOperation_t    trans,
+                                            const int             m,
+                                            const int             n,
+                                            const int             k,
+                                            hipblasComplex* const A[],
+                                            const int             lda,
+                                            hipblasComplex* const ipiv[],
+                                            hipblasComplex* const C[],
+                                            const int             ldc,
+                                            int*                  info,
+                                            const int             batch_count);
+
+hipblasStatus_t hipblasZunmqrBatchedFortran(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasOperation_t          trans,
+                                            const int                   m,
+                                            const int                   n,
+                                            const int                   k,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            hipblasDoubleComplex* const ipiv[],
+                                            hipblasDoubleComplex* const C[],
+                                            const int                   ldc,
+                                            int*                        info,
+                                            const int                   batch_count);
+
+// ormqr_strided_batched
+hipblasStatus_t hipblasSormqrStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasOperation_t  trans,
+                                                   const int           m,
+                                                   const int           n,
+                                                   const int           k,
+                                                   float*              A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   float*              ipiv,
+                                                   const hipblasStride strideP,
+                                                   float*              C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batch_count);
+
+hipblasStatus_t hipblasDormqrStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasOperation_t  trans,
+                                                   const int           m,
+                                                   const int           n,
+                                                   const int           k,
+                                                   double*             A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   double*             ipiv,
+                                                   const hipblasStride strideP,
+                                                   double*             C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batch_count);
+
+hipblasStatus_t hipblasCunmqrStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasOperation_t  trans,
+                                                   const int           m,
+                                                   const int           n,
+                                                   const int           k,
+                                                   hipblasComplex*     A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   hipblasComplex*     ipiv,
+                                                   const hipblasStride strideP,
+                                                   hipblasComplex*     C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batch_count);
+
+hipblasStatus_t hipblasZunmqrStridedBatchedFortran(hipblasHandle_t       handle,
+                                                   hipblasSideMode_t     side,
+                                                   hipblasOperation_t    trans,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const int             k,
+                                                   hipblasDoubleComplex* A,
+                                                   const int             lda,
+                                                   const hipblasStride   strideA,
+                                                   hipblasDoubleComplex* ipiv,
+                                                   const hipblasStride   strideP,
+                                                   hipblasDoubleComplex* C,
+                                                   const int             ldc,
+                                                   const hipblasStride   strideC,
+                                                   int*                  info,
+                                                   const int             batch_count);
 }
 
 #ifdef HIPBLAS_V2
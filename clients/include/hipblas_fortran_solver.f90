@@ -1121,3 +1121,1128 @@ function hipblasZgelsStridedBatchedFortran(handle, trans, m, n, nrhs, A, &
         hipblasZgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
     B, ldb, strideB, info, deviceInfo, batchCount)
 end function hipblasZgelsStridedBatchedFortran
+
+! potrf
+function hipblasSpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasSpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotrfFortran = &
+        hipblasSpotrf(handle, uplo, n, A, lda, info)
+end function hipblasSpotrfFortran
+
+function hipblasDpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasDpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotrfFortran = &
+        hipblasDpotrf(handle, uplo, n, A, lda, info)
+end function hipblasDpotrfFortran
+
+function hipblasCpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasCpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotrfFortran = &
+        hipblasCpotrf(handle, uplo, n, A, lda, info)
+end function hipblasCpotrfFortran
+
+function hipblasZpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasZpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotrfFortran = &
+        hipblasZpotrf(handle, uplo, n, A, lda, info)
+end function hipblasZpotrfFortran
+
+! potrf_batched
+function hipblasSpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasSpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrfBatchedFortran = &
+        hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasSpotrfBatchedFortran
+
+function hipblasDpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasDpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrfBatchedFortran = &
+        hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasDpotrfBatchedFortran
+
+function hipblasCpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasCpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrfBatchedFortran = &
+        hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasCpotrfBatchedFortran
+
+function hipblasZpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasZpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrfBatchedFortran = &
+        hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasZpotrfBatchedFortran
+
+! potrf_strided_batched
+function hipblasSpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batch_count) &
+    bind(c, name='hipblasSpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrfStridedBatchedFortran = &
+        hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasSpotrfStridedBatchedFortran
+
+function hipblasDpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batch_count) &
+    bind(c, name='hipblasDpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrfStridedBatchedFortran = &
+        hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasDpotrfStridedBatchedFortran
+
+function hipblasCpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batch_count) &
+    bind(c, name='hipblasCpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrfStridedBatchedFortran = &
+        hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasCpotrfStridedBatchedFortran
+
+function hipblasZpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batch_count) &
+    bind(c, name='hipblasZpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrfStridedBatchedFortran = &
+        hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasZpotrfStridedBatchedFortran
+
+! potrs
+function hipblasSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasSpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasSpotrsFortran = &
+        hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasSpotrsFortran
+
+function hipblasDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasDpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasDpotrsFortran = &
+        hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasDpotrsFortran
+
+function hipblasCpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasCpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasCpotrsFortran = &
+        hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasCpotrsFortran
+
+function hipblasZpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasZpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasZpotrsFortran = &
+        hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasZpotrsFortran
+
+! potrs_batched
+function hipblasSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+    bind(c, name='hipblasSpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrsBatchedFortran = &
+        hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasSpotrsBatchedFortran
+
+function hipblasDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+    bind(c, name='hipblasDpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrsBatchedFortran = &
+        hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasDpotrsBatchedFortran
+
+function hipblasCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+    bind(c, name='hipblasCpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrsBatchedFortran = &
+        hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasCpotrsBatchedFortran
+
+function hipblasZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+    bind(c, name='hipblasZpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrsBatchedFortran = &
+        hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasZpotrsBatchedFortran
+
+! potrs_strided_batched
+function hipblasSpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasSpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrsStridedBatchedFortran = &
+        hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, &
+                                    batch_count)
+end function hipblasSpotrsStridedBatchedFortran
+
+function hipblasDpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasDpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrsStridedBatchedFortran = &
+        hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, &
+                                    batch_count)
+end function hipblasDpotrsStridedBatchedFortran
+
+function hipblasCpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasCpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrsStridedBatchedFortran = &
+        hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, &
+                                    batch_count)
+end function hipblasCpotrsStridedBatchedFortran
+
+function hipblasZpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasZpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrsStridedBatchedFortran = &
+        hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, &
+                                    batch_count)
+end function hipblasZpotrsStridedBatchedFortran
+
+! gesv_batched
+function hipblasSgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                    batch_count) &
+    bind(c, name='hipblasSgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasSgesvBatchedFortran = &
+        hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, batch_count)
+end function hipblasSgesvBatchedFortran
+
+function hipblasDgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                    batch_count) &
+    bind(c, name='hipblasDgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasDgesvBatchedFortran = &
+        hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, batch_count)
+end function hipblasDgesvBatchedFortran
+
+function hipblasCgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                    batch_count) &
+    bind(c, name='hipblasCgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasCgesvBatchedFortran = &
+        hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, batch_count)
+end function hipblasCgesvBatchedFortran
+
+function hipblasZgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                    batch_count) &
+    bind(c, name='hipblasZgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasZgesvBatchedFortran = &
+        hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, batch_count)
+end function hipblasZgesvBatchedFortran
+
+! gesv_strided_batched
+function hipblasSgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                           ldb, strideB, info, deviceInfo, batch_count) &
+    bind(c, name='hipblasSgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasSgesvStridedBatchedFortran = &
+        hipblasSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, deviceInfo, batch_count)
+end function hipblasSgesvStridedBatchedFortran
+
+function hipblasDgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                           ldb, strideB, info, deviceInfo, batch_count) &
+    bind(c, name='hipblasDgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasDgesvStridedBatchedFortran = &
+        hipblasDgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, deviceInfo, batch_count)
+end function hipblasDgesvStridedBatchedFortran
+
+function hipblasCgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                           ldb, strideB, info, deviceInfo, batch_count) &
+    bind(c, name='hipblasCgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasCgesvStridedBatchedFortran = &
+        hipblasCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, deviceInfo, batch_count)
+end function hipblasCgesvStridedBatchedFortran
+
+function hipblasZgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                           ldb, strideB, info, deviceInfo, batch_count) &
+    bind(c, name='hipblasZgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasZgesvStridedBatchedFortran = &
+        hipblasZgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, deviceInfo, batch_count)
+end function hipblasZgesvStridedBatchedFortran
+
+! getri
+function hipblasSgetriFortran(handle, n, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasSgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasSgetriFortran = &
+        hipblasSgetri(handle, n, A, lda, ipiv, C, ldc, info)
+end function hipblasSgetriFortran
+
+function hipblasDgetriFortran(handle, n, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasDgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasDgetriFortran = &
+        hipblasDgetri(handle, n, A, lda, ipiv, C, ldc, info)
+end function hipblasDgetriFortran
+
+function hipblasCgetriFortran(handle, n, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasCgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasCgetriFortran = &
+        hipblasCgetri(handle, n, A, lda, ipiv, C, ldc, info)
+end function hipblasCgetriFortran
+
+function hipblasZgetriFortran(handle, n, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasZgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasZgetriFortran = &
+        hipblasZgetri(handle, n, A, lda, ipiv, C, ldc, info)
+end function hipblasZgetriFortran
+
+! getri_strided_batched
+function hipblasSgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                            strideC, info, batch_count) &
+    bind(c, name='hipblasSgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgetriStridedBatchedFortran = &
+        hipblasSgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, &
+                                    info, batch_count)
+end function hipblasSgetriStridedBatchedFortran
+
+function hipblasDgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                            strideC, info, batch_count) &
+    bind(c, name='hipblasDgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgetriStridedBatchedFortran = &
+        hipblasDgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, &
+                                    info, batch_count)
+end function hipblasDgetriStridedBatchedFortran
+
+function hipblasCgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                            strideC, info, batch_count) &
+    bind(c, name='hipblasCgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgetriStridedBatchedFortran = &
+        hipblasCgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, &
+                                    info, batch_count)
+end function hipblasCgetriStridedBatchedFortran
+
+function hipblasZgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                            strideC, info, batch_count) &
+    bind(c, name='hipblasZgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgetriStridedBatchedFortran = &
+        hipblasZgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, &
+                                    info, batch_count)
+end function hipblasZgetriStridedBatchedFortran
+
+! ormqr
+function hipblasSormqrFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasSormqrFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSormqrFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasSormqrFortran = &
+        hipblasSormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info)
+end function hipblasSormqrFortran
+
+function hipblasDormqrFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasDormqrFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDormqrFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasDormqrFortran = &
+        hipblasDormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info)
+end function hipblasDormqrFortran
+
+function hipblasCunmqrFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasCunmqrFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCunmqrFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasCunmqrFortran = &
+        hipblasCunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info)
+end function hipblasCunmqrFortran
+
+function hipblasZunmqrFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+    bind(c, name='hipblasZunmqrFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZunmqrFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasZunmqrFortran = &
+        hipblasZunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info)
+end function hipblasZunmqrFortran
+
+! ormqr_batched
+function hipblasSormqrBatchedFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                     batch_count) &
+    bind(c, name='hipblasSormqrBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSormqrBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSormqrBatchedFortran = &
+        hipblasSormqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, batch_count)
+end function hipblasSormqrBatchedFortran
+
+function hipblasDormqrBatchedFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                     batch_count) &
+    bind(c, name='hipblasDormqrBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDormqrBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDormqrBatchedFortran = &
+        hipblasDormqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, batch_count)
+end function hipblasDormqrBatchedFortran
+
+function hipblasCunmqrBatchedFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                     batch_count) &
+    bind(c, name='hipblasCunmqrBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCunmqrBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCunmqrBatchedFortran = &
+        hipblasCunmqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, batch_count)
+end function hipblasCunmqrBatchedFortran
+
+function hipblasZunmqrBatchedFortran(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                     batch_count) &
+    bind(c, name='hipblasZunmqrBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZunmqrBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZunmqrBatchedFortran = &
+        hipblasZunmqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, batch_count)
+end function hipblasZunmqrBatchedFortran
+
+! ormqr_strided_batched
+function hipblasSormqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasSormqrStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSormqrStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSormqrStridedBatchedFortran = &
+        hipblasSormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, strideP, &
+                                    C, ldc, strideC, info, batch_count)
+end function hipblasSormqrStridedBatchedFortran
+
+function hipblasDormqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasDormqrStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDormqrStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDormqrStridedBatchedFortran = &
+        hipblasDormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, strideP, &
+                                    C, ldc, strideC, info, batch_count)
+end function hipblasDormqrStridedBatchedFortran
+
+function hipblasCunmqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasCunmqrStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCunmqrStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCunmqrStridedBatchedFortran = &
+        hipblasCunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, strideP, &
+                                    C, ldc, strideC, info, batch_count)
+end function hipblasCunmqrStridedBatchedFortran
+
+function hipblasZunmqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasZunmqrStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZunmqrStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    integer(c_int), value :: k
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZunmqrStridedBatchedFortran = &
+        hipblasZunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, strideP, &
+                                    C, ldc, strideC, info, batch_count)
+end function hipblasZunmqrStridedBatchedFortran
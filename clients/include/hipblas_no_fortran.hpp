@@ -695,5 +695,57 @@
 #define hipblasDgeqrfStridedBatchedFortran hipblasDgeqrfStridedBatched
 #define hipblasCgeqrfStridedBatchedFortran hipblasCgeqrfStridedBatched
 #define hipblasZgeqrfStridedBatchedFortran hipblasZgeqrfStridedBatched
+#define hipblasSpotrfFortran hipblasSpotrf
+#define hipblasDpotrfFortran hipblasDpotrf
+#define hipblasCpotrfFortran hipblasCpotrf
+#define hipblasZpotrfFortran hipblasZpotrf
+#define hipblasSpotrfBatchedFortran hipblasSpotrfBatched
+#define hipblasDpotrfBatchedFortran hipblasDpotrfBatched
+#define hipblasCpotrfBatchedFortran hipblasCpotrfBatched
+#define hipblasZpotrfBatchedFortran hipblasZpotrfBatched
+#define hipblasSpotrfStridedBatchedFortran hipblasSpotrfStridedBatched
+#define hipblasDpotrfStridedBatchedFortran hipblasDpotrfStridedBatched
+#define hipblasCpotrfStridedBatchedFortran hipblasCpotrfStridedBatched
+#define hipblasZpotrfStridedBatchedFortran hipblasZpotrfStridedBatched
+#define hipblasSpotrsFortran hipblasSpotrs
+#define hipblasDpotrsFortran hipblasDpotrs
+#define hipblasCpotrsFortran hipblasCpotrs
+#define hipblasZpotrsFortran hipblasZpotrs
+#define hipblasSpotrsBatchedFortran hipblasSpotrsBatched
+#define hipblasDpotrsBatchedFortran hipblasDpotrsBatched
+#define hipblasCpotrsBatchedFortran hipblasCpotrsBatched
+#define hipblasZpotrsBatchedFortran hipblasZpotrsBatched
+#define hipblasSpotrsStridedBatchedFortran hipblasSpotrsStridedBatched
+#define hipblasDpotrsStridedBatchedFortran hipblasDpotrsStridedBatched
+#define hipblasCpotrsStridedBatchedFortran hipblasCpotrsStridedBatched
+#define hipblasZpotrsStridedBatchedFortran hipblasZpotrsStridedBatched
+#define hipblasSgesvBatchedFortran hipblasSgesvBatched
+#define hipblasDgesvBatchedFortran hipblasDgesvBatched
+#define hipblasCgesvBatchedFortran hipblasCgesvBatched
+#define hipblasZgesvBatchedFortran hipblasZgesvBatched
+#define hipblasSgesvStridedBatchedFortran hipblasSgesvStridedBatched
+#define hipblasDgesvStridedBatchedFortran hipblasDgesvStridedBatched
+#define hipblasCgesvStridedBatchedFortran hipblasCgesvStridedBatched
+#define hipblasZgesvStridedBatchedFortran hipblasZgesvStridedBatched
+#define hipblasSgetriFortran hipblasSgetri
+#define hipblasDgetriFortran hipblasDgetri
+#define hipblasCgetriFortran hipblasCgetri
+#define hipblasZgetriFortran hipblasZgetri
+#define hipblasSgetriStridedBatchedFortran hipblasSgetriStridedBatched
+#define hipblasDgetriStridedBatchedFortran hipblasDgetriStridedBatched
+#define hipblasCgetriStridedBatchedFortran hipblasCgetriStridedBatched
+#define hipblasZgetriStridedBatchedFortran hipblasZgetriStridedBatched
+#define hipblasSormqrFortran hipblasSormqr
+#define hipblasDormqrFortran hipblasDormqr
+#define hipblasCunmqrFortran hipblasCunmqr
+#define hipblasZunmqrFortran hipblasZunmqr
+#define hipblasSormqrBatchedFortran hipblasSormqrBatched
+#define hipblasDormqrBatchedFortran hipblasDormqrBatched
+#define hipblasCunmqrBatchedFortran hipblasCunmqrBatched
+#define hipblasZunmqrBatchedFortran hipblasZunmqrBatched
+#define hipblasSormqrStridedBatchedFortran hipblasSormqrStridedBatched
+#define hipblasDormqrStridedBatchedFortran hipblasDormqrStridedBatched
+#define hipblasCunmqrStridedBatchedFortran hipblasCunmqrStridedBatched
+#define hipblasZunmqrStridedBatchedFortran hipblasZunmqrStridedBatched
 
 #endif
@@ -152,6 +152,16 @@ inline void hipblas_expect_status(hipblasStatus_t status, hipblasStatus_t expect
 #define CHECK_HIPBLAS_ERROR2(STATUS) EXPECT_HIPBLAS_STATUS2(STATUS, HIPBLAS_STATUS_SUCCESS)
 #define ASSERT_HIPBLAS_SUCCESS(STATUS) CHECK_HIPBLAS_ERROR2(STATUS)
 
+// Calls F ARGS, or F##_64 ARGS when arg.api selects the _64 functions
+#define DAPI_CHECK(F, ARGS)                      \
+    do                                           \
+    {                                            \
+        if(arg.api == hipblas_client_api::C_64)  \
+            ASSERT_HIPBLAS_SUCCESS(F##_64 ARGS); \
+        else                                     \
+            ASSERT_HIPBLAS_SUCCESS(F ARGS);      \
+    } while(0)
+
 #ifdef GOOGLE_TEST
 
 // The tests are instantiated by filtering through the HipBLAS_Data stream
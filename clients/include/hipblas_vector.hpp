@@ -501,6 +501,30 @@ inline void hipblas_init_matrix(host_vector<T>&        hA,
     }
 }
 
+//!
+//! @brief Initialize host arrays holding one alpha and one beta for each batch.
+//! @param h_alpha The host array of alpha.
+//! @param h_beta The host array of beta.
+//! @param arg Specifies the argument class. Every batch uses its alpha and beta unless
+//!            arg.with_scalar_arrays is set, then every other pair of batches swaps them.
+//! @param batch_count number of instances in the batch.
+//!
+template <typename T>
+inline void hipblas_init_batch_scalars(host_vector<T>&  h_alpha,
+                                       host_vector<T>&  h_beta,
+                                       const Arguments& arg,
+                                       int              batch_count)
+{
+    T alpha = arg.get_alpha<T>();
+    T beta  = arg.get_beta<T>();
+    for(int b = 0; b < batch_count; b++)
+    {
+        bool swap  = arg.with_scalar_arrays && (b / 2) % 2;
+        h_alpha[b] = swap ? beta : alpha;
+        h_beta[b]  = swap ? alpha : beta;
+    }
+}
+
 //!
 //! @brief Template for initializing a host (non_batched|batched|strided_batched)vector.
 //! @param that That vector.
@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasDSgesvModel = ArgumentModel<e_a_type, e_N, e_K, e_lda, e_ldb>;
+
+inline void testname_dsgesv(const Arguments& arg, std::string& name)
+{
+    hipblasDSgesvModel{}.test_name(arg, name);
+}
+
+// Initializes A to be well conditioned, so the refinement converges, and B = A*X for a random X
+template <typename T>
+inline void setup_dsgesv_testing(
+    host_vector<T>& hA, host_vector<T>& hB, host_vector<T>& hX, int N, int nrhs, int lda, int ldb)
+{
+    srand(1);
+    hipblas_init<T>(hA, N, N, lda);
+    hipblas_init<T>(hX, N, nrhs, ldb);
+
+    // scale A to avoid singularities
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                hA[i + j * lda] += 400;
+            else
+                hA[i + j * lda] -= 4;
+        }
+    }
+
+    hipblasOperation_t opN = HIPBLAS_OP_N;
+    cblas_gemm<T>(
+        opN, opN, N, nrhs, N, (T)1, hA.data(), lda, hX.data(), ldb, (T)0, hB.data(), ldb);
+}
+
+template <typename T>
+void testing_dsgesv_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    const int          N      = 100;
+    const int          nrhs   = 1;
+    const int          lda    = 101;
+    const int          ldb    = 102;
+    const size_t       A_size = size_t(N) * lda;
+    const size_t       B_size = ldb;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(B_size);
+    device_vector<int> dIpiv(N);
+    int                iter = 0, info = 0;
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldb, &iter, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, -1, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, -1, dA, lda, dIpiv, dB, ldb, dX, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, nullptr, lda, dIpiv, dB, ldb, dX, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, N - 1, dIpiv, dB, ldb, dX, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, lda, nullptr, dB, ldb, dX, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, nullptr, ldb, dX, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, dB, N - 1, dX, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    // X must not be B
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dB, ldb, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, N - 1, &iter, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldb, nullptr, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-10, info);
+
+    // If N == 0, A, B, X and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(
+            handle, 0, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr, ldb, &iter, &info),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If nrhs == 0, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasDSgesv(handle, N, 0, dA, lda, dIpiv, nullptr, ldb, nullptr, ldb, &iter, &info),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+}
+
+template <typename T>
+void testing_dsgesv(const Arguments& arg)
+{
+    int N    = arg.N;
+    int nrhs = arg.K;
+    int lda  = arg.lda;
+    int ldb  = arg.ldb;
+
+    size_t A_size = size_t(lda) * N;
+    size_t B_size = size_t(ldb) * nrhs;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hX_res(B_size);
+    host_vector<int> hIpiv(N);
+    int              iter, info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(B_size);
+    device_vector<int> dIpiv(N);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_dsgesv_testing(hA, hB, hX, N, nrhs, lda, ldb);
+
+    // A is overwritten only when the refinement falls back to double precision
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(
+            hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldb, &iter, &info));
+
+        // copy output from device to CPU
+        ASSERT_HIP_SUCCESS(hipMemcpy(hX_res, dX, B_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        cblas_getrf<T>(N, N, hA.data(), lda, hIpiv.data());
+        cblas_getrs<T>('N', N, nrhs, hA.data(), lda, hIpiv.data(), hB.data(), ldb);
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldb, hB.data(), hX_res.data());
+
+        if(arg.unit_check)
+        {
+            // The refined solution has the accuracy of a double precision solve
+            T      eps       = std::numeric_limits<T>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            EXPECT_GE(iter, 0);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int it = 0; it < runs; it++)
+        {
+            if(it == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(
+                hipblasDSgesv(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldb, &iter, &info));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // Counted as the double precision solve it replaces
+        hipblasDSgesvModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         gesv_gflop_count<T>(N, nrhs),
+                                         ArgumentLogging::NA_value,
+                                         hipblas_error);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_dsgesv_ret(const Arguments& arg)
+{
+    // Only the double precision solve is refined in single precision
+    if constexpr(!std::is_same_v<T, double>)
+        throw std::invalid_argument(std::string("Invalid combination --function dsgesv --a_type ")
+                                    + hipblas_datatype2string(arg.a_type));
+    else
+        testing_dsgesv<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
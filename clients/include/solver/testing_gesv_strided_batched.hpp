@@ -0,0 +1,483 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvStridedBatchedModel
+    = ArgumentModel<e_a_type, e_N, e_K, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_gesv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvStridedBatchedModel{}.test_name(arg, name);
+}
+
+// Initializes each A_i to be well conditioned and B_i = A_i*X_i for a random X_i
+template <typename T>
+inline void setup_gesv_strided_batched_testing(host_vector<T>& hA,
+                                               host_vector<T>& hB,
+                                               host_vector<T>& hX,
+                                               int             N,
+                                               int             nrhs,
+                                               int             lda,
+                                               int             ldb,
+                                               hipblasStride   strideA,
+                                               hipblasStride   strideB,
+                                               int             batch_count)
+{
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, nrhs, ldb);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] += 400;
+                else
+                    hAb[i + j * lda] -= 4;
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, nrhs, N, (T)1, hAb, lda, hXb, ldb, (T)0, hBb, ldb);
+    }
+}
+
+template <typename T>
+void testing_gesv_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGesvStridedBatchedFn
+        = arg.fortran ? hipblasGesvStridedBatched<T, true> : hipblasGesvStridedBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 100;
+    const int          nrhs        = 1;
+    const int          lda         = 101;
+    const int          ldb         = 102;
+    const int          batch_count = 2;
+    hipblasStride      strideA     = size_t(lda) * N;
+    hipblasStride      strideB     = size_t(ldb) * nrhs;
+    hipblasStride      strideP     = size_t(N);
+    size_t             A_size      = strideA * batch_count;
+    size_t             B_size      = strideB * batch_count;
+    size_t             Ipiv_size   = strideP * batch_count;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+    int                info = 0;
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       nullptr,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       -1,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       -1,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       N - 1,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       nullptr,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       nullptr,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       N - 1,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       nullptr,
+                                                       batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-12, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       -1),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-13, info);
+
+    // If N == 0, A, B, and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       0,
+                                                       nrhs,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       nullptr,
+                                                       strideP,
+                                                       nullptr,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       0,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       nullptr,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count),
+                           HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If batch_count == 0, deviceInfo can be nullptr
+    EXPECT_HIPBLAS_STATUS2(hipblasGesvStridedBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       nullptr,
+                                                       0),
+                           HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+}
+
+template <typename T>
+void testing_gesv_strided_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.fortran;
+    auto hipblasGesvStridedBatchedFn
+        = FORTRAN ? hipblasGesvStridedBatched<T, true> : hipblasGesvStridedBatched<T, false>;
+
+    int    N            = arg.N;
+    int    nrhs         = arg.K;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride strideA   = size_t(lda) * N * stride_scale;
+    hipblasStride strideB   = size_t(ldb) * nrhs * stride_scale;
+    hipblasStride strideP   = size_t(N) * stride_scale;
+    size_t        A_size    = strideA * batch_count;
+    size_t        B_size    = strideB * batch_count;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hB1(B_size);
+    host_vector<int> hIpiv(Ipiv_size);
+    host_vector<int> hInfo(batch_count);
+    host_vector<int> hInfo1(batch_count);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_gesv_strided_batched_testing(
+        hA, hB, hX, N, nrhs, lda, ldb, strideA, strideB, batch_count);
+
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasGesvStridedBatchedFn(handle,
+                                                           N,
+                                                           nrhs,
+                                                           dA,
+                                                           lda,
+                                                           strideA,
+                                                           dIpiv,
+                                                           strideP,
+                                                           dB,
+                                                           ldb,
+                                                           strideB,
+                                                           &info,
+                                                           dInfo,
+                                                           batch_count));
+
+        // copy output from device to CPU
+        ASSERT_HIP_SUCCESS(hipMemcpy(hB1.data(), dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_HIP_SUCCESS(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            hInfo[b] = cblas_getrf<T>(
+                N, N, hA.data() + b * strideA, lda, hIpiv.data() + b * strideP);
+            cblas_getrs('N',
+                        N,
+                        nrhs,
+                        hA.data() + b * strideA,
+                        lda,
+                        hIpiv.data() + b * strideP,
+                        hB.data() + b * strideB,
+                        ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldb, strideB, hB, hB1, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasGesvStridedBatchedFn(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvStridedBatchedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     gesv_gflop_count<T>(N, nrhs),
+                                                     ArgumentLogging::NA_value,
+                                                     hipblas_error);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_gesv_strided_batched_ret(const Arguments& arg)
+{
+    testing_gesv_strided_batched<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
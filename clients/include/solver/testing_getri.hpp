@@ -0,0 +1,159 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGetriModel = ArgumentModel<e_a_type, e_N, e_lda>;
+
+inline void testname_getri(const Arguments& arg, std::string& name)
+{
+    hipblasGetriModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_getri(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.fortran;
+    auto hipblasGetriFn = FORTRAN ? hipblasGetri<T, true> : hipblasGetri<T, false>;
+
+    int M   = arg.N;
+    int N   = arg.N;
+    int lda = arg.lda;
+
+    size_t A_size    = size_t(lda) * N;
+    size_t Ipiv_size = std::min(M, N);
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < M)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hA1(A_size);
+    host_vector<T>   hC(A_size);
+    host_vector<int> hIpiv(Ipiv_size);
+    host_vector<int> hInfo(1);
+    host_vector<int> hInfo1(1);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dC(A_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(1);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init<T>(hA, M, N, lda);
+
+    // scale A to avoid singularities
+    for(int i = 0; i < M; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                hA[i + j * lda] += 400;
+            else
+                hA[i + j * lda] -= 4;
+        }
+    }
+
+    // perform LU factorization on A
+    hInfo[0] = cblas_getrf(M, N, hA.data(), lda, hIpiv.data());
+
+    ASSERT_HIP_SUCCESS(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dC, hC, A_size * sizeof(T), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemcpy(dIpiv, hIpiv, Ipiv_size * sizeof(int), hipMemcpyHostToDevice));
+    ASSERT_HIP_SUCCESS(hipMemset(dInfo, 0, sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetriFn(handle, N, dA, lda, dIpiv, dC, lda, dInfo));
+
+        // Copy output from device to CPU
+        ASSERT_HIP_SUCCESS(hipMemcpy(hA1, dC, A_size * sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_HIP_SUCCESS(hipMemcpy(hInfo1, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        // Workspace query
+        host_vector<T> work(1);
+        cblas_getri(N, hA.data(), lda, hIpiv.data(), work.data(), -1);
+        int lwork = type2int(work[0]);
+
+        // Perform inversion
+        work     = host_vector<T>(lwork);
+        hInfo[0] = cblas_getri(N, hA.data(), lda, hIpiv.data(), work.data(), lwork);
+
+        hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasGetriFn(handle, N, dA, lda, dIpiv, dC, lda, dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGetriModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        getri_gflop_count<T>(N),
+                                        ArgumentLogging::NA_value,
+                                        hipblas_error);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_getri_ret(const Arguments& arg)
+{
+    testing_getri<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,299 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasOrmqrModel = ArgumentModel<e_a_type, e_side, e_transA, e_M, e_N, e_K, e_lda, e_ldc>;
+
+inline void testname_ormqr(const Arguments& arg, std::string& name)
+{
+    hipblasOrmqrModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t setup_ormqr_testing(host_vector<T>&   hA,
+                                           host_vector<T>&   hIpiv,
+                                           host_vector<T>&   hC,
+                                           device_vector<T>& dA,
+                                           device_vector<T>& dIpiv,
+                                           device_vector<T>& dC,
+                                           int               nq,
+                                           int               M,
+                                           int               N,
+                                           int               K,
+                                           int               lda,
+                                           int               ldc)
+{
+    const size_t A_size    = size_t(lda) * K;
+    const size_t C_size    = size_t(ldc) * N;
+    const size_t Ipiv_size = std::max(1, K);
+
+    // Initial hA and hC on CPU
+    srand(1);
+    hipblas_init<T>(hA, nq, K, lda);
+    hipblas_init<T>(hC, M, N, ldc);
+
+    // Q is given by the QR factorization of the nq-by-K matrix A
+    host_vector<T> work(1);
+    cblas_geqrf(nq, K, hA.data(), lda, hIpiv.data(), work.data(), -1);
+    int lwork = std::max(1, type2int(work[0]));
+    work      = host_vector<T>(lwork);
+    cblas_geqrf(nq, K, hA.data(), lda, hIpiv.data(), work.data(), lwork);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv, Ipiv_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, C_size * sizeof(T), hipMemcpyHostToDevice));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+void testing_ormqr_bad_arg(const Arguments& arg)
+{
+    auto hipblasOrmqrFn = arg.fortran ? hipblasOrmqr<T, true> : hipblasOrmqr<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          M      = 100;
+    const int          N      = 101;
+    const int          K      = 50;
+    const int          lda    = 102;
+    const int          ldc    = 103;
+    const size_t       A_size = size_t(lda) * K;
+    const size_t       C_size = size_t(ldc) * N;
+
+    const hipblasSideMode_t  side  = HIPBLAS_SIDE_LEFT;
+    const hipblasOperation_t trans = HIPBLAS_OP_N;
+    const hipblasOperation_t bad_trans = is_complex<T> ? HIPBLAS_OP_T : HIPBLAS_OP_C;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hIpiv(K);
+    host_vector<T> hC(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dIpiv(K);
+    device_vector<T> dC(C_size);
+    int              info = 0;
+
+    EXPECT_HIPBLAS_STATUS2(
+        setup_ormqr_testing(hA, hIpiv, hC, dA, dIpiv, dC, M, M, N, K, lda, ldc),
+        HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, ldc, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, HIPBLAS_SIDE_BOTH, trans, M, N, K, dA, lda, dIpiv, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, bad_trans, M, N, K, dA, lda, dIpiv, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, -1, N, K, dA, lda, dIpiv, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, -1, K, dA, lda, dIpiv, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, M + 1, dA, lda, dIpiv, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, K, nullptr, lda, dIpiv, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, K, dA, M - 1, dIpiv, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, K, dA, lda, nullptr, dC, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, K, dA, lda, dIpiv, nullptr, ldc, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, M - 1, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-10, info);
+
+    // If K == 0, Q is the identity and A and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrFn(handle, side, trans, M, N, 0, nullptr, lda, nullptr, dC, ldc, &info),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+}
+
+template <typename T>
+void testing_ormqr(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.fortran;
+    auto hipblasOrmqrFn = FORTRAN ? hipblasOrmqr<T, true> : hipblasOrmqr<T, false>;
+
+    hipblasSideMode_t  side  = char2hipblas_side(arg.side);
+    hipblasOperation_t trans = char2hipblas_operation(arg.transA);
+    int                M     = arg.M;
+    int                N     = arg.N;
+    int                K     = arg.K;
+    int                lda   = arg.lda;
+    int                ldc   = arg.ldc;
+    int                nq    = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    size_t A_size    = size_t(lda) * K;
+    size_t C_size    = size_t(ldc) * N;
+    size_t Ipiv_size = std::max(1, K);
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || K < 0 || K > nq || lda < std::max(1, nq) || ldc < std::max(1, M))
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hIpiv(Ipiv_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC1(C_size);
+    int            info;
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dIpiv(Ipiv_size);
+    device_vector<T> dC(C_size);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS2(
+        setup_ormqr_testing(hA, hIpiv, hC, dA, dIpiv, dC, nq, M, N, K, lda, ldc),
+        HIPBLAS_STATUS_SUCCESS);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(
+            hipblasOrmqrFn(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, ldc, &info));
+
+        // copy output from device to CPU
+        ASSERT_HIP_SUCCESS(hipMemcpy(hC1, dC, C_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        // Workspace query
+        host_vector<T> work(1);
+        cblas_ormqr(arg.side,
+                    arg.transA,
+                    M,
+                    N,
+                    K,
+                    hA.data(),
+                    lda,
+                    hIpiv.data(),
+                    hC.data(),
+                    ldc,
+                    work.data(),
+                    -1);
+        int lwork = std::max(1, type2int(work[0]));
+
+        work = host_vector<T>(lwork);
+        cblas_ormqr(arg.side,
+                    arg.transA,
+                    M,
+                    N,
+                    K,
+                    hA.data(),
+                    lda,
+                    hIpiv.data(),
+                    hC.data(),
+                    ldc,
+                    work.data(),
+                    lwork);
+
+        hipblas_error = norm_check_general<T>('F', M, N, ldc, hC.data(), hC1.data());
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = nq * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(
+                hipblasOrmqrFn(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, ldc, &info));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasOrmqrModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        ormqr_gflop_count<T>(M, N, K, side == HIPBLAS_SIDE_LEFT),
+                                        ArgumentLogging::NA_value,
+                                        hipblas_error);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_ormqr_ret(const Arguments& arg)
+{
+    testing_ormqr<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,360 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasOrmqrBatchedModel
+    = ArgumentModel<e_a_type, e_side, e_transA, e_M, e_N, e_K, e_lda, e_ldc, e_batch_count>;
+
+inline void testname_ormqr_batched(const Arguments& arg, std::string& name)
+{
+    hipblasOrmqrBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t setup_ormqr_batched_testing(host_batch_vector<T>&   hA,
+                                                   host_batch_vector<T>&   hIpiv,
+                                                   host_batch_vector<T>&   hC,
+                                                   device_batch_vector<T>& dA,
+                                                   device_batch_vector<T>& dIpiv,
+                                                   device_batch_vector<T>& dC,
+                                                   int                     nq,
+                                                   int                     M,
+                                                   int                     N,
+                                                   int                     K,
+                                                   int                     lda,
+                                                   int                     ldc,
+                                                   int                     batch_count)
+{
+    // Initial hA and hC on CPU
+    srand(1);
+    hipblas_init(hA, true);
+    hipblas_init(hC);
+
+    // Q is given by the QR factorization of each nq-by-K matrix A
+    host_vector<T> work(1);
+    cblas_geqrf(nq, K, hA[0], lda, hIpiv[0], work.data(), -1);
+    int lwork = std::max(1, type2int(work[0]));
+    work      = host_vector<T>(lwork);
+    for(int b = 0; b < batch_count; b++)
+    {
+        cblas_geqrf(nq, K, hA[b], lda, hIpiv[b], work.data(), lwork);
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+void testing_ormqr_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasOrmqrBatchedFn
+        = arg.fortran ? hipblasOrmqrBatched<T, true> : hipblasOrmqrBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          M           = 100;
+    const int          N           = 101;
+    const int          K           = 50;
+    const int          lda         = 102;
+    const int          ldc         = 103;
+    const int          batch_count = 2;
+    const size_t       A_size      = size_t(lda) * K;
+    const size_t       C_size      = size_t(ldc) * N;
+
+    const hipblasSideMode_t  side      = HIPBLAS_SIDE_LEFT;
+    const hipblasOperation_t trans     = HIPBLAS_OP_N;
+    const hipblasOperation_t bad_trans = is_complex<T> ? HIPBLAS_OP_T : HIPBLAS_OP_C;
+
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hIpiv(K, 1, batch_count);
+    host_batch_vector<T> hC(C_size, 1, batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dIpiv(K, 1, batch_count);
+    device_batch_vector<T> dC(C_size, 1, batch_count);
+    int                    info = 0;
+
+    T* const* dAp    = dA.ptr_on_device();
+    T* const* dIpivp = dIpiv.ptr_on_device();
+    T* const* dCp    = dC.ptr_on_device();
+
+    EXPECT_HIPBLAS_STATUS2(setup_ormqr_batched_testing(
+                               hA, hIpiv, hC, dA, dIpiv, dC, M, M, N, K, lda, ldc, batch_count),
+                           HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, dAp, lda, dIpivp, dCp, ldc, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasOrmqrBatchedFn(handle,
+                                                 HIPBLAS_SIDE_BOTH,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 dAp,
+                                                 lda,
+                                                 dIpivp,
+                                                 dCp,
+                                                 ldc,
+                                                 &info,
+                                                 batch_count),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, bad_trans, M, N, K, dAp, lda, dIpivp, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, -1, N, K, dAp, lda, dIpivp, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, -1, K, dAp, lda, dIpivp, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, M + 1, dAp, lda, dIpivp, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, nullptr, lda, dIpivp, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, dAp, M - 1, dIpivp, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, dAp, lda, nullptr, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, dAp, lda, dIpivp, nullptr, ldc, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, dAp, lda, dIpivp, dCp, M - 1, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-10, info);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, dAp, lda, dIpivp, dCp, ldc, &info, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-12, info);
+
+    // If K == 0, Q is the identity and A and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, 0, nullptr, lda, nullptr, dCp, ldc, &info, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If batch_count == 0, all pointers can be nullptr
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasOrmqrBatchedFn(
+            handle, side, trans, M, N, K, nullptr, lda, nullptr, nullptr, ldc, &info, 0),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+}
+
+template <typename T>
+void testing_ormqr_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.fortran;
+    auto hipblasOrmqrBatchedFn
+        = FORTRAN ? hipblasOrmqrBatched<T, true> : hipblasOrmqrBatched<T, false>;
+
+    hipblasSideMode_t  side        = char2hipblas_side(arg.side);
+    hipblasOperation_t trans       = char2hipblas_operation(arg.transA);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+    int                nq          = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    size_t A_size    = size_t(lda) * K;
+    size_t C_size    = size_t(ldc) * N;
+    size_t Ipiv_size = std::max(1, K);
+    int    info;
+
+    hipblasLocalHandle handle(arg);
+
+    // Check to prevent memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || K > nq || lda < std::max(1, nq)
+                        || ldc < std::max(1, M) || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hIpiv(Ipiv_size, 1, batch_count);
+    host_batch_vector<T> hC(C_size, 1, batch_count);
+    host_batch_vector<T> hC1(C_size, 1, batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dIpiv(Ipiv_size, 1, batch_count);
+    device_batch_vector<T> dC(C_size, 1, batch_count);
+
+    double gpu_time_used, hipblas_error;
+
+    EXPECT_HIPBLAS_STATUS2(setup_ormqr_batched_testing(
+                               hA, hIpiv, hC, dA, dIpiv, dC, nq, M, N, K, lda, ldc, batch_count),
+                           HIPBLAS_STATUS_SUCCESS);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasOrmqrBatchedFn(handle,
+                                                     side,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     dA.ptr_on_device(),
+                                                     lda,
+                                                     dIpiv.ptr_on_device(),
+                                                     dC.ptr_on_device(),
+                                                     ldc,
+                                                     &info,
+                                                     batch_count));
+
+        ASSERT_HIP_SUCCESS(hC1.transfer_from(dC));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        // Workspace query
+        host_vector<T> work(1);
+        cblas_ormqr(
+            arg.side, arg.transA, M, N, K, hA[0], lda, hIpiv[0], hC[0], ldc, work.data(), -1);
+        int lwork = std::max(1, type2int(work[0]));
+
+        work = host_vector<T>(lwork);
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_ormqr(arg.side,
+                        arg.transA,
+                        M,
+                        N,
+                        K,
+                        hA[b],
+                        lda,
+                        hIpiv[b],
+                        hC[b],
+                        ldc,
+                        work.data(),
+                        lwork);
+        }
+
+        hipblas_error = norm_check_general<T>('F', M, N, ldc, hC, hC1, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = nq * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasOrmqrBatchedFn(handle,
+                                                         side,
+                                                         trans,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         dA.ptr_on_device(),
+                                                         lda,
+                                                         dIpiv.ptr_on_device(),
+                                                         dC.ptr_on_device(),
+                                                         ldc,
+                                                         &info,
+                                                         batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasOrmqrBatchedModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ormqr_gflop_count<T>(M, N, K, side == HIPBLAS_SIDE_LEFT) * batch_count,
+            ArgumentLogging::NA_value,
+            hipblas_error);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_ormqr_batched_ret(const Arguments& arg)
+{
+    testing_ormqr_batched<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,242 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotrsModel = ArgumentModel<e_a_type, e_uplo, e_N, e_lda, e_ldb>;
+
+inline void testname_potrs(const Arguments& arg, std::string& name)
+{
+    hipblasPotrsModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t setup_potrs_testing(host_vector<T>&   hA,
+                                           host_vector<T>&   hB,
+                                           host_vector<T>&   hX,
+                                           device_vector<T>& dA,
+                                           device_vector<T>& dB,
+                                           char              uplo,
+                                           int               N,
+                                           int               lda,
+                                           int               ldb)
+{
+    const size_t A_size = size_t(N) * lda;
+    const size_t B_size = ldb;
+
+    // Initial hA, hB, hX on CPU
+    srand(1);
+    hipblas_init_hpd<T>(hA, N, lda);
+    hipblas_init<T>(hX, N, 1, ldb);
+
+    // Calculate hB = hA*hX;
+    hipblasOperation_t opN = HIPBLAS_OP_N;
+    cblas_gemm<T>(opN, opN, N, 1, N, (T)1, hA.data(), lda, hX.data(), ldb, (T)0, hB.data(), ldb);
+
+    // Cholesky factorize hA on the CPU
+    int info = cblas_potrf<T>(uplo, N, hA.data(), lda);
+    if(info != 0)
+    {
+        std::cerr << "Cholesky decomposition failed" << std::endl;
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+void testing_potrs_bad_arg(const Arguments& arg)
+{
+    auto hipblasPotrsFn = arg.fortran ? hipblasPotrs<T, true> : hipblasPotrs<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N      = 100;
+    const int          nrhs   = 1;
+    const int          lda    = 101;
+    const int          ldb    = 102;
+    const size_t       A_size = size_t(N) * lda;
+    const size_t       B_size = ldb;
+
+    const hipblasFillMode_t uplo = HIPBLAS_FILL_MODE_LOWER;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hX(B_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    int              info = 0;
+
+    // Need initialization code because even with bad params we call rocSOLVER
+    // so want to give reasonable data
+    EXPECT_HIPBLAS_STATUS2(setup_potrs_testing(hA, hB, hX, dA, dB, 'L', N, lda, ldb),
+                           HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, N, nrhs, dA, lda, dB, ldb, nullptr),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS2(
+        hipblasPotrsFn(handle, HIPBLAS_FILL_MODE_FULL, N, nrhs, dA, lda, dB, ldb, &info),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, -1, nrhs, dA, lda, dB, ldb, &info),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, N, -1, dA, lda, dB, ldb, &info),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, N, nrhs, nullptr, lda, dB, ldb, &info),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, N, nrhs, dA, N - 1, dB, ldb, &info),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, N, nrhs, dA, lda, nullptr, ldb, &info),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, N, nrhs, dA, lda, dB, N - 1, &info),
+                           HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    // If N == 0, A and B can be nullptr
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, 0, nrhs, nullptr, lda, nullptr, ldb, &info),
+                           HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // if nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS2(hipblasPotrsFn(handle, uplo, N, 0, dA, lda, nullptr, ldb, &info),
+                           HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+}
+
+template <typename T>
+void testing_potrs(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.fortran;
+    auto hipblasPotrsFn = FORTRAN ? hipblasPotrs<T, true> : hipblasPotrs<T, false>;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
+    int               N    = arg.N;
+    int               lda  = arg.lda;
+    int               ldb  = arg.ldb;
+
+    size_t A_size = size_t(lda) * N;
+    size_t B_size = ldb * 1;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hX(B_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB1(B_size);
+    int            info;
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS2(setup_potrs_testing(hA, hB, hX, dA, dB, arg.uplo, N, lda, ldb),
+                           HIPBLAS_STATUS_SUCCESS);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        ASSERT_HIPBLAS_SUCCESS(hipblasPotrsFn(handle, uplo, N, 1, dA, lda, dB, ldb, &info));
+
+        // copy output from device to CPU
+        ASSERT_HIP_SUCCESS(hipMemcpy(hB1, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        cblas_potrs(arg.uplo, N, 1, hA.data(), lda, hB.data(), ldb);
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB.data(), hB1.data());
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        ASSERT_HIPBLAS_SUCCESS(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            ASSERT_HIPBLAS_SUCCESS(hipblasPotrsFn(handle, uplo, N, 1, dA, lda, dB, ldb, &info));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasPotrsModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        potrs_gflop_count<T>(N, 1),
+                                        ArgumentLogging::NA_value,
+                                        hipblas_error);
+    }
+}
+
+template <typename T>
+hipblasStatus_t testing_potrs_ret(const Arguments& arg)
+{
+    testing_potrs<T>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -234,6 +234,23 @@ template <>
 HIPBLAS_CLANG_STATIC constexpr double hipblas_type_epsilon<
     hipblasBfloat16> = 0.0078125; // in bf16 diff between 0x3F80 (1.0) and bf16 0x3F81 in double precision
 
+/* =============================================================================================== */
+/* hipDataType of each type, for functions taking hipDataType with or without HIPBLAS_V2.          */
+template <typename>
+HIPBLAS_CLANG_STATIC constexpr hipDataType hipblas_hip_datatype = hipDataType(31);
+template <>
+HIPBLAS_CLANG_STATIC constexpr hipDataType hipblas_hip_datatype<hipblasHalf> = HIP_R_16F;
+template <>
+HIPBLAS_CLANG_STATIC constexpr hipDataType hipblas_hip_datatype<hipblasBfloat16> = HIP_R_16BF;
+template <>
+HIPBLAS_CLANG_STATIC constexpr hipDataType hipblas_hip_datatype<float> = HIP_R_32F;
+template <>
+HIPBLAS_CLANG_STATIC constexpr hipDataType hipblas_hip_datatype<double> = HIP_R_64F;
+template <>
+HIPBLAS_CLANG_STATIC constexpr hipDataType hipblas_hip_datatype<hipblasComplex> = HIP_C_32F;
+template <>
+HIPBLAS_CLANG_STATIC constexpr hipDataType hipblas_hip_datatype<hipblasDoubleComplex> = HIP_C_64F;
+
 /* ============================================================================================ */
 /*! \brief  Random number generator which generates NaN values */
 
@@ -714,6 +731,23 @@ void hipblas_init_hermitian(std::vector<T>& A, int N, int lda)
                 A[j + i * lda] = A[i + j * lda] = random_generator<T>();
 }
 
+/*! \brief  hermitian positive definite matrix initialization: */
+// symmetric for real matrix; the diagonal is made to dominate each row so that
+// the Cholesky factorization exists
+template <typename T>
+void hipblas_init_hpd(T* A, int N, int lda)
+{
+    for(int i = 0; i < N; ++i)
+        for(int j = 0; j <= i; ++j)
+            if(i == j)
+                A[j + i * lda] = T(random_generator<real_t<T>>() + 20 * N);
+            else
+            {
+                A[i + j * lda] = random_generator<T>();
+                A[j + i * lda] = std::conj(A[i + j * lda]);
+            }
+}
+
 /* ============================================================================================ */
 /*! \brief  Initialize an array with random data, with NaN where appropriate */
 
@@ -750,6 +784,25 @@ inline void regular_to_packed(bool upper, const T* A, T* AP, int n)
                 AP[index++] = A[j + i * n];
 }
 
+/* ============================================================================================= */
+/*! \brief For testing purposes, to copy a rows x cols matrix between row-major storage, where
+           element (i, j) is at i * ld + j, and column-major storage, where it is at i + j * ld. */
+template <typename T>
+inline void row_to_col_major(const T* A, int lda, T* B, int ldb, int rows, int cols)
+{
+    for(int i = 0; i < rows; i++)
+        for(int j = 0; j < cols; j++)
+            B[i + size_t(j) * ldb] = A[size_t(i) * lda + j];
+}
+
+template <typename T>
+inline void col_to_row_major(const T* A, int lda, T* B, int ldb, int rows, int cols)
+{
+    for(int i = 0; i < rows; i++)
+        for(int j = 0; j < cols; j++)
+            B[size_t(i) * ldb + j] = A[i + size_t(j) * lda];
+}
+
 /* ============================================================================ */
 /* \brief For testing purposes, to convert a regular matrix to a banded matrix. */
 template <typename T>
@@ -77,6 +77,9 @@ cat <<EOF
 
     -n, --no-solver               Build hipLBAS library without rocSOLVER dependency
 
+    --no-hipblaslt                Build hipBLAS library without hipBLASLt dependency, so that hipblasGemmExWithEpilogue
+                                  supports only empty epilogues on the rocBLAS backend
+
     --no-hip-clang                Build library without using hip-clang compiler.
 
     -p, --cmakepp                 To add CMAKE_PREFIX_PATH
@@ -285,6 +288,14 @@ install_packages( )
         library_dependencies_sles+=( "rocsolver" )
       fi
     fi
+
+    if [[ "${build_hipblaslt}" == true ]]; then
+      library_dependencies_ubuntu+=( "hipblaslt" )
+      library_dependencies_centos_rhel+=( "hipblaslt" )
+      library_dependencies_centos_rhel_8+=( "hipblaslt" )
+      library_dependencies_fedora+=( "hipblaslt" )
+      library_dependencies_sles+=( "hipblaslt" )
+    fi
   fi
 
   # wget is needed for cmake
@@ -426,6 +437,7 @@ install_dependencies=false
 install_prefix=hipblas-install
 build_clients=false
 build_solver=true
+build_hipblaslt=true
 build_cuda=false
 build_release=true
 build_relocatable=false
@@ -451,7 +463,7 @@ declare -a cmake_client_options
 # check if we have a modern version of getopt that can handle whitespace and long parameters
 getopt -T
 if [[ $? -eq 4 ]]; then
-  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,codecoverage,clients,no-solver,dependencies,debug,hip-clang,no-hip-clang,compiler:,cmake_install,cuda,use-cuda,cudapath:,installcuda,installcudaversion:,static,cmakepp,relocatable:,rocm-dev:,rocblas:,rocblas-path:,rocsolver-path:,custom-target:,address-sanitizer,rm-legacy-include-dir,cmake-arg: --options rhicndgp:v:b: -- "$@")
+  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,codecoverage,clients,no-solver,no-hipblaslt,dependencies,debug,hip-clang,no-hip-clang,compiler:,cmake_install,cuda,use-cuda,cudapath:,installcuda,installcudaversion:,static,cmakepp,relocatable:,rocm-dev:,rocblas:,rocblas-path:,rocsolver-path:,custom-target:,address-sanitizer,rm-legacy-include-dir,cmake-arg: --options rhicndgp:v:b: -- "$@")
 else
   echo "Need a new version of getopt"
   exit 1
@@ -485,6 +497,9 @@ while true; do
     -n|--no-solver)
         build_solver=false
         shift ;;
+    --no-hipblaslt)
+        build_hipblaslt=false
+        shift ;;
     -g|--debug)
         build_release=false
         shift ;;
@@ -684,6 +699,11 @@ pushd .
     cmake_common_options+=("-DBUILD_WITH_SOLVER=OFF")
   fi
 
+  # hipBLASLt
+  if [[ "${build_hipblaslt}" == false ]]; then
+    cmake_common_options+=("-DBUILD_WITH_HIPBLASLT=OFF")
+  fi
+
   # sanitizer
   if [[ "${build_address_sanitizer}" == true ]]; then
     cmake_common_options+=("-DBUILD_ADDRESS_SANITIZER=ON")
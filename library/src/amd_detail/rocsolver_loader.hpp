@@ -0,0 +1,226 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+// With BUILD_WITH_SOLVER, hipBLAS does not link rocSOLVER. It is opened with dlopen on the
+// first call to a solver function, so processes that only use BLAS functions do not pay to
+// load and relocate it. Include after the rocSOLVER declarations; each rocsolver_* function
+// used is redefined below to resolve its address on first call.
+
+#include "rocblas/rocblas.h"
+#include <cstdio>
+#include <dlfcn.h>
+#include <mutex>
+
+// Returns the address of the rocSOLVER function name. Throws HIPBLAS_STATUS_NOT_SUPPORTED
+// if rocSOLVER cannot be loaded or does not export name.
+inline void* hipblasRocsolverSymbol(const char* name)
+{
+    static std::once_flag once;
+    static void*          library = nullptr;
+
+    std::call_once(once, [] {
+        library = dlopen(HIPBLAS_ROCSOLVER_LIBRARY, RTLD_NOW | RTLD_LOCAL);
+        if(!library)
+            std::fprintf(stderr, "hipBLAS: cannot load rocSOLVER: %s\n", dlerror());
+    });
+
+    void* symbol = library ? dlsym(library, name) : nullptr;
+    if(!symbol)
+        throw HIPBLAS_STATUS_NOT_SUPPORTED;
+    return symbol;
+}
+
+// The address of FN, looked up once. The lookup is retried if it throws.
+#define HIPBLAS_ROCSOLVER_FUNCTION(FN)                                       \
+    ([] {                                                                    \
+        static const auto fn__ = (decltype(&FN))hipblasRocsolverSymbol(#FN); \
+        return fn__;                                                         \
+    }())
+
+// FN is not expanded again inside the expansion of its own macro, so it names the declaration
+#define rocsolver_cgels HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgels)
+#define rocsolver_cgels_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgels_batched)
+#define rocsolver_cgels_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgels_strided_batched)
+#define rocsolver_cgeqrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgeqrf)
+#define rocsolver_cgeqrf_ptr_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgeqrf_ptr_batched)
+#define rocsolver_cgeqrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgeqrf_strided_batched)
+#define rocsolver_cgesv_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgesv_batched)
+#define rocsolver_cgesv_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgesv_strided_batched)
+#define rocsolver_cgetrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrf)
+#define rocsolver_cgetrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrf_batched)
+#define rocsolver_cgetrf_npvt HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrf_npvt)
+#define rocsolver_cgetrf_npvt_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrf_npvt_batched)
+#define rocsolver_cgetrf_npvt_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrf_npvt_strided_batched)
+#define rocsolver_cgetrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrf_strided_batched)
+#define rocsolver_cgetri_npvt_outofplace \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetri_npvt_outofplace)
+#define rocsolver_cgetri_npvt_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetri_npvt_outofplace_batched)
+#define rocsolver_cgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetri_npvt_outofplace_strided_batched)
+#define rocsolver_cgetri_outofplace HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetri_outofplace)
+#define rocsolver_cgetri_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetri_outofplace_batched)
+#define rocsolver_cgetri_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetri_outofplace_strided_batched)
+#define rocsolver_cgetrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrs)
+#define rocsolver_cgetrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrs_batched)
+#define rocsolver_cgetrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cgetrs_strided_batched)
+#define rocsolver_cpotrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cpotrf)
+#define rocsolver_cpotrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cpotrf_batched)
+#define rocsolver_cpotrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cpotrf_strided_batched)
+#define rocsolver_cpotrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cpotrs)
+#define rocsolver_cpotrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cpotrs_batched)
+#define rocsolver_cpotrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cpotrs_strided_batched)
+#define rocsolver_cunmqr HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_cunmqr)
+#define rocsolver_dgels HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgels)
+#define rocsolver_dgels_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgels_batched)
+#define rocsolver_dgels_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgels_strided_batched)
+#define rocsolver_dgeqrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgeqrf)
+#define rocsolver_dgeqrf_ptr_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgeqrf_ptr_batched)
+#define rocsolver_dgeqrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgeqrf_strided_batched)
+#define rocsolver_dgesv_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgesv_batched)
+#define rocsolver_dgesv_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgesv_strided_batched)
+#define rocsolver_dgetrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrf)
+#define rocsolver_dgetrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrf_batched)
+#define rocsolver_dgetrf_npvt HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrf_npvt)
+#define rocsolver_dgetrf_npvt_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrf_npvt_batched)
+#define rocsolver_dgetrf_npvt_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrf_npvt_strided_batched)
+#define rocsolver_dgetrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrf_strided_batched)
+#define rocsolver_dgetri_npvt_outofplace \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetri_npvt_outofplace)
+#define rocsolver_dgetri_npvt_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetri_npvt_outofplace_batched)
+#define rocsolver_dgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetri_npvt_outofplace_strided_batched)
+#define rocsolver_dgetri_outofplace HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetri_outofplace)
+#define rocsolver_dgetri_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetri_outofplace_batched)
+#define rocsolver_dgetri_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetri_outofplace_strided_batched)
+#define rocsolver_dgetrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrs)
+#define rocsolver_dgetrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrs_batched)
+#define rocsolver_dgetrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dgetrs_strided_batched)
+#define rocsolver_dormqr HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dormqr)
+#define rocsolver_dpotrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dpotrf)
+#define rocsolver_dpotrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dpotrf_batched)
+#define rocsolver_dpotrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dpotrf_strided_batched)
+#define rocsolver_dpotrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dpotrs)
+#define rocsolver_dpotrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dpotrs_batched)
+#define rocsolver_dpotrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_dpotrs_strided_batched)
+#define rocsolver_sgels HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgels)
+#define rocsolver_sgels_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgels_batched)
+#define rocsolver_sgels_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgels_strided_batched)
+#define rocsolver_sgeqrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgeqrf)
+#define rocsolver_sgeqrf_ptr_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgeqrf_ptr_batched)
+#define rocsolver_sgeqrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgeqrf_strided_batched)
+#define rocsolver_sgesv_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgesv_batched)
+#define rocsolver_sgesv_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgesv_strided_batched)
+#define rocsolver_sgetrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrf)
+#define rocsolver_sgetrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrf_batched)
+#define rocsolver_sgetrf_npvt HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrf_npvt)
+#define rocsolver_sgetrf_npvt_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrf_npvt_batched)
+#define rocsolver_sgetrf_npvt_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrf_npvt_strided_batched)
+#define rocsolver_sgetrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrf_strided_batched)
+#define rocsolver_sgetri_npvt_outofplace \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetri_npvt_outofplace)
+#define rocsolver_sgetri_npvt_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetri_npvt_outofplace_batched)
+#define rocsolver_sgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetri_npvt_outofplace_strided_batched)
+#define rocsolver_sgetri_outofplace HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetri_outofplace)
+#define rocsolver_sgetri_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetri_outofplace_batched)
+#define rocsolver_sgetri_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetri_outofplace_strided_batched)
+#define rocsolver_sgetrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrs)
+#define rocsolver_sgetrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrs_batched)
+#define rocsolver_sgetrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sgetrs_strided_batched)
+#define rocsolver_sormqr HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_sormqr)
+#define rocsolver_spotrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_spotrf)
+#define rocsolver_spotrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_spotrf_batched)
+#define rocsolver_spotrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_spotrf_strided_batched)
+#define rocsolver_spotrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_spotrs)
+#define rocsolver_spotrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_spotrs_batched)
+#define rocsolver_spotrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_spotrs_strided_batched)
+#define rocsolver_zgels HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgels)
+#define rocsolver_zgels_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgels_batched)
+#define rocsolver_zgels_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgels_strided_batched)
+#define rocsolver_zgeqrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgeqrf)
+#define rocsolver_zgeqrf_ptr_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgeqrf_ptr_batched)
+#define rocsolver_zgeqrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgeqrf_strided_batched)
+#define rocsolver_zgesv_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgesv_batched)
+#define rocsolver_zgesv_strided_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgesv_strided_batched)
+#define rocsolver_zgetrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrf)
+#define rocsolver_zgetrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrf_batched)
+#define rocsolver_zgetrf_npvt HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrf_npvt)
+#define rocsolver_zgetrf_npvt_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrf_npvt_batched)
+#define rocsolver_zgetrf_npvt_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrf_npvt_strided_batched)
+#define rocsolver_zgetrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrf_strided_batched)
+#define rocsolver_zgetri_npvt_outofplace \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetri_npvt_outofplace)
+#define rocsolver_zgetri_npvt_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetri_npvt_outofplace_batched)
+#define rocsolver_zgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetri_npvt_outofplace_strided_batched)
+#define rocsolver_zgetri_outofplace HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetri_outofplace)
+#define rocsolver_zgetri_outofplace_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetri_outofplace_batched)
+#define rocsolver_zgetri_outofplace_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetri_outofplace_strided_batched)
+#define rocsolver_zgetrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrs)
+#define rocsolver_zgetrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrs_batched)
+#define rocsolver_zgetrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zgetrs_strided_batched)
+#define rocsolver_zpotrf HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zpotrf)
+#define rocsolver_zpotrf_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zpotrf_batched)
+#define rocsolver_zpotrf_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zpotrf_strided_batched)
+#define rocsolver_zpotrs HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zpotrs)
+#define rocsolver_zpotrs_batched HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zpotrs_batched)
+#define rocsolver_zpotrs_strided_batched \
+    HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zpotrs_strided_batched)
+#define rocsolver_zunmqr HIPBLAS_ROCSOLVER_FUNCTION(rocsolver_zunmqr)
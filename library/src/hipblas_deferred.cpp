@@ -0,0 +1,665 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "gemm_ex.hpp"
+#include "handle_state.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr int default_max_batch_count = 256;
+
+    // Element sizes of A, B and C and the size of alpha and beta for a call, all
+    // 0 if the types are not known
+    struct hipblasGemmSizes
+    {
+        size_t a = 0, b = 0, c = 0, scalar = 0;
+    };
+
+    hipblasGemmSizes gemm_sizes(const hipblasDeferredGemm& gemm)
+    {
+        hipblasGemmSizes sizes;
+        if(!std::strcmp(gemm.function, "hipblasSgemm"))
+        {
+            sizes.a = sizes.b = sizes.c = sizes.scalar = sizeof(float);
+        }
+        else if(!std::strcmp(gemm.function, "hipblasGemmEx"))
+        {
+            sizes.a      = hipblasDatatypeSize(hipblasDatatype_t(gemm.aType));
+            sizes.b      = hipblasDatatypeSize(hipblasDatatype_t(gemm.bType));
+            sizes.c      = hipblasDatatypeSize(hipblasDatatype_t(gemm.cType));
+            sizes.scalar = hipblasDatatypeSize(hipblasDatatype_t(gemm.computeType));
+        }
+        else if(!std::strcmp(gemm.function, "hipblasGemmEx_v2"))
+        {
+            sizes.a = hipblasDatatypeSize(hipDataType(gemm.aType));
+            sizes.b = hipblasDatatypeSize(hipDataType(gemm.bType));
+            sizes.c = hipblasDatatypeSize(hipDataType(gemm.cType));
+            sizes.scalar = hipblasGemmExScalarSize(hipblasComputeType_t(gemm.computeType),
+                                                   hipDataType(gemm.cType));
+        }
+        if(!sizes.a || !sizes.b || !sizes.c || !sizes.scalar)
+            return {};
+        return sizes;
+    }
+
+    // Bytes spanned by a column-major rows x cols matrix
+    size_t matrix_span(int rows, int cols, int ld, size_t elem_size)
+    {
+        return (size_t(ld) * (cols - 1) + rows) * elem_size;
+    }
+
+    struct hipblasMatrixRange
+    {
+        const char* begin;
+        const char* end;
+
+        bool overlaps(const hipblasMatrixRange& rhs) const
+        {
+            return begin < rhs.end && rhs.begin < end;
+        }
+    };
+
+    // Calls collected by deferred batching on one handle. All pending calls share
+    // every argument except A, B and C.
+    struct hipblasDeferredGemms
+    {
+        std::mutex mutex;
+        int        max_batch_count;
+
+        hipblasDeferredGemm             key; // the first pending call
+        hipblasGemmSizes                sizes;
+        bool                            device_scalars = false;
+        unsigned char                   alpha[16]; // values of alpha and beta
+        unsigned char                   beta[16]; //  in host pointer mode
+        std::vector<const void*>        A, B;
+        std::vector<void*>              C;
+        std::vector<hipblasMatrixRange> read_ranges, write_ranges;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS; // first error from issuing calls
+
+        // Device pointer arrays for hipblasSgemmBatched and hipblasGemmBatchedEx
+        std::vector<const void*> host_pointers;
+        void*                    device_pointers      = nullptr;
+        size_t                   device_pointers_size = 0;
+        hipStream_t              device_pointers_stream{};
+        hipblasDeviceAllocator   device_pointers_allocator; // that allocated device_pointers
+
+        ~hipblasDeferredGemms()
+        {
+            device_pointers_allocator.free(device_pointers, device_pointers_stream);
+        }
+
+        bool matches(const hipblasDeferredGemm& gemm, bool device_mode) const
+        {
+            if(gemm.function != key.function || gemm.transA != key.transA
+               || gemm.transB != key.transB || gemm.m != key.m || gemm.n != key.n
+               || gemm.k != key.k || gemm.lda != key.lda || gemm.ldb != key.ldb
+               || gemm.ldc != key.ldc || gemm.aType != key.aType || gemm.bType != key.bType
+               || gemm.cType != key.cType || gemm.computeType != key.computeType
+               || gemm.algo != key.algo || device_mode != device_scalars)
+                return false;
+            if(device_scalars)
+                return gemm.alpha == key.alpha && gemm.beta == key.beta;
+            return !std::memcmp(gemm.alpha, alpha, sizes.scalar)
+                   && !std::memcmp(gemm.beta, beta, sizes.scalar);
+        }
+
+        // True if gemm reads or writes memory a pending call writes, or writes
+        // memory a pending call reads
+        bool depends_on_pending(const hipblasMatrixRange& a,
+                                const hipblasMatrixRange& b,
+                                const hipblasMatrixRange& c) const
+        {
+            for(auto& w : write_ranges)
+                if(w.overlaps(a) || w.overlaps(b) || w.overlaps(c))
+                    return true;
+            for(auto& r : read_ranges)
+                if(r.overlaps(c))
+                    return true;
+            return false;
+        }
+    };
+
+    std::mutex                                                                 handle_gemms_mutex;
+    std::unordered_map<hipblasHandle_t, std::shared_ptr<hipblasDeferredGemms>> handle_gemms;
+
+    // Set while this thread issues collected calls, so that they are not collected again
+    thread_local bool issuing = false;
+
+    std::shared_ptr<hipblasDeferredGemms> find_deferred_gemms(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(handle_gemms_mutex);
+        auto                        it = handle_gemms.find(handle);
+        return it == handle_gemms.end() ? nullptr : it->second;
+    }
+
+    // Removes the deferred batching state of handle
+    std::shared_ptr<hipblasDeferredGemms> take_deferred_gemms(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex>           lock(handle_gemms_mutex);
+        std::shared_ptr<hipblasDeferredGemms> state;
+        auto                                  it = handle_gemms.find(handle);
+        if(it != handle_gemms.end())
+        {
+            state = std::move(it->second);
+            handle_gemms.erase(it);
+            if(handle_gemms.empty())
+                hipblas_layer_mode.fetch_and(~uint32_t(HIPBLAS_LAYER_DEFERRED_GEMM));
+        }
+        return state;
+    }
+
+    // Constant distance in elements between consecutive pointers, if there is one
+    template <typename T>
+    bool constant_stride(const std::vector<T>& ptrs, size_t elem_size, hipblasStride& stride)
+    {
+        auto diff = [](T lhs, T rhs) {
+            return intptr_t(reinterpret_cast<const char*>(lhs))
+                   - intptr_t(reinterpret_cast<const char*>(rhs));
+        };
+        intptr_t bytes = ptrs.size() > 1 ? diff(ptrs[1], ptrs[0]) : 0;
+        if(bytes % intptr_t(elem_size))
+            return false;
+        for(size_t i = 2; i < ptrs.size(); i++)
+            if(diff(ptrs[i], ptrs[i - 1]) != bytes)
+                return false;
+        stride = bytes / intptr_t(elem_size);
+        return true;
+    }
+
+    hipblasStatus_t issue_single(hipblasHandle_t            handle,
+                                 const hipblasDeferredGemm& g,
+                                 const void*                alpha,
+                                 const void*                beta,
+                                 const void*                A,
+                                 const void*                B,
+                                 void*                      C)
+    {
+        if(!std::strcmp(g.function, "hipblasSgemm"))
+            return hipblasSgemm(handle,
+                                g.transA,
+                                g.transB,
+                                g.m,
+                                g.n,
+                                g.k,
+                                static_cast<const float*>(alpha),
+                                static_cast<const float*>(A),
+                                g.lda,
+                                static_cast<const float*>(B),
+                                g.ldb,
+                                static_cast<const float*>(beta),
+                                static_cast<float*>(C),
+                                g.ldc);
+        if(!std::strcmp(g.function, "hipblasGemmEx"))
+            return hipblasGemmEx(handle,
+                                 g.transA,
+                                 g.transB,
+                                 g.m,
+                                 g.n,
+                                 g.k,
+                                 alpha,
+                                 A,
+                                 hipblasDatatype_t(g.aType),
+                                 g.lda,
+                                 B,
+                                 hipblasDatatype_t(g.bType),
+                                 g.ldb,
+                                 beta,
+                                 C,
+                                 hipblasDatatype_t(g.cType),
+                                 g.ldc,
+                                 hipblasDatatype_t(g.computeType),
+                                 g.algo);
+        return hipblasGemmEx_v2(handle,
+                                g.transA,
+                                g.transB,
+                                g.m,
+                                g.n,
+                                g.k,
+                                alpha,
+                                A,
+                                hipDataType(g.aType),
+                                g.lda,
+                                B,
+                                hipDataType(g.bType),
+                                g.ldb,
+                                beta,
+                                C,
+                                hipDataType(g.cType),
+                                g.ldc,
+                                hipblasComputeType_t(g.computeType),
+                                g.algo);
+    }
+
+    hipblasStatus_t issue_strided(hipblasHandle_t            handle,
+                                  const hipblasDeferredGemm& g,
+                                  const void*                alpha,
+                                  const void*                beta,
+                                  hipblasStride              stride_a,
+                                  hipblasStride              stride_b,
+                                  hipblasStride              stride_c,
+                                  int                        batch_count)
+    {
+        if(!std::strcmp(g.function, "hipblasSgemm"))
+            return hipblasSgemmStridedBatched(handle,
+                                              g.transA,
+                                              g.transB,
+                                              g.m,
+                                              g.n,
+                                              g.k,
+                                              static_cast<const float*>(alpha),
+                                              static_cast<const float*>(g.A),
+                                              g.lda,
+                                              stride_a,
+                                              static_cast<const float*>(g.B),
+                                              g.ldb,
+                                              stride_b,
+                                              static_cast<const float*>(beta),
+                                              static_cast<float*>(g.C),
+                                              g.ldc,
+                                              stride_c,
+                                              batch_count);
+        if(!std::strcmp(g.function, "hipblasGemmEx"))
+            return hipblasGemmStridedBatchedEx(handle,
+                                               g.transA,
+                                               g.transB,
+                                               g.m,
+                                               g.n,
+                                               g.k,
+                                               alpha,
+                                               g.A,
+                                               hipblasDatatype_t(g.aType),
+                                               g.lda,
+                                               stride_a,
+                                               g.B,
+                                               hipblasDatatype_t(g.bType),
+                                               g.ldb,
+                                               stride_b,
+                                               beta,
+                                               g.C,
+                                               hipblasDatatype_t(g.cType),
+                                               g.ldc,
+                                               stride_c,
+                                               batch_count,
+                                               hipblasDatatype_t(g.computeType),
+                                               g.algo);
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              g.transA,
+                                              g.transB,
+                                              g.m,
+                                              g.n,
+                                              g.k,
+                                              alpha,
+                                              g.A,
+                                              hipDataType(g.aType),
+                                              g.lda,
+                                              stride_a,
+                                              g.B,
+                                              hipDataType(g.bType),
+                                              g.ldb,
+                                              stride_b,
+                                              beta,
+                                              g.C,
+                                              hipDataType(g.cType),
+                                              g.ldc,
+                                              stride_c,
+                                              batch_count,
+                                              hipblasComputeType_t(g.computeType),
+                                              g.algo);
+    }
+
+    hipblasStatus_t issue_batched(hipblasHandle_t            handle,
+                                  const hipblasDeferredGemm& g,
+                                  const void*                alpha,
+                                  const void*                beta,
+                                  const void* const*         A,
+                                  const void* const*         B,
+                                  void* const*               C,
+                                  int                        batch_count)
+    {
+        if(!std::strcmp(g.function, "hipblasSgemm"))
+            return hipblasSgemmBatched(handle,
+                                       g.transA,
+                                       g.transB,
+                                       g.m,
+                                       g.n,
+                                       g.k,
+                                       static_cast<const float*>(alpha),
+                                       reinterpret_cast<const float* const*>(A),
+                                       g.lda,
+                                       reinterpret_cast<const float* const*>(B),
+                                       g.ldb,
+                                       static_cast<const float*>(beta),
+                                       reinterpret_cast<float* const*>(C),
+                                       g.ldc,
+                                       batch_count);
+        if(!std::strcmp(g.function, "hipblasGemmEx"))
+            return hipblasGemmBatchedEx(handle,
+                                        g.transA,
+                                        g.transB,
+                                        g.m,
+                                        g.n,
+                                        g.k,
+                                        alpha,
+                                        const_cast<const void**>(A),
+                                        hipblasDatatype_t(g.aType),
+                                        g.lda,
+                                        const_cast<const void**>(B),
+                                        hipblasDatatype_t(g.bType),
+                                        g.ldb,
+                                        beta,
+                                        const_cast<void**>(C),
+                                        hipblasDatatype_t(g.cType),
+                                        g.ldc,
+                                        batch_count,
+                                        hipblasDatatype_t(g.computeType),
+                                        g.algo);
+        return hipblasGemmBatchedEx_v2(handle,
+                                       g.transA,
+                                       g.transB,
+                                       g.m,
+                                       g.n,
+                                       g.k,
+                                       alpha,
+                                       const_cast<const void**>(A),
+                                       hipDataType(g.aType),
+                                       g.lda,
+                                       const_cast<const void**>(B),
+                                       hipDataType(g.bType),
+                                       g.ldb,
+                                       beta,
+                                       const_cast<void**>(C),
+                                       hipDataType(g.cType),
+                                       g.ldc,
+                                       batch_count,
+                                       hipblasComputeType_t(g.computeType),
+                                       g.algo);
+    }
+
+    // Copies the pointer arrays of the pending calls to device memory owned by
+    // state and returns the device copies of A, B and C
+    hipblasStatus_t upload_pointers(hipblasHandle_t       handle,
+                                    hipblasDeferredGemms& state,
+                                    const void* const*&   A,
+                                    const void* const*&   B,
+                                    void* const*&         C)
+    {
+        size_t count = state.A.size();
+        state.host_pointers.assign(state.A.begin(), state.A.end());
+        state.host_pointers.insert(state.host_pointers.end(), state.B.begin(), state.B.end());
+        state.host_pointers.insert(state.host_pointers.end(), state.C.begin(), state.C.end());
+        size_t size = state.host_pointers.size() * sizeof(void*);
+
+        hipStream_t stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // The arrays may still be read by calls issued on the previous stream
+        if(state.device_pointers && stream != state.device_pointers_stream
+           && hipStreamSynchronize(state.device_pointers_stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        if(size > state.device_pointers_size)
+        {
+            state.device_pointers_allocator.free(state.device_pointers, stream);
+            state.device_pointers      = nullptr;
+            state.device_pointers_size = 0;
+
+            state.device_pointers_allocator
+                = hipblasGetHandleState(handle)->get_user_workspace().allocator;
+            state.device_pointers = state.device_pointers_allocator.allocate(size, stream);
+            if(!state.device_pointers)
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            state.device_pointers_size = size;
+        }
+
+        // host_pointers is pageable, so it may be reused once the copy is enqueued
+        if(hipMemcpyAsync(
+               state.device_pointers, state.host_pointers.data(), size, hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        state.device_pointers_stream = stream;
+
+        auto device = static_cast<void**>(state.device_pointers);
+        A           = device;
+        B           = device + count;
+        C           = device + 2 * count;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Issues the pending calls of state as one call. state.mutex must be held.
+    hipblasStatus_t issue_pending(hipblasHandle_t handle, hipblasDeferredGemms& state)
+    {
+        int count = int(state.A.size());
+        if(!count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        const hipblasDeferredGemm& g     = state.key;
+        const void*                alpha = state.device_scalars ? g.alpha : state.alpha;
+        const void*                beta  = state.device_scalars ? g.beta : state.beta;
+
+        issuing = true;
+        hipblasStatus_t status;
+        hipblasStride   stride_a, stride_b, stride_c;
+        if(count == 1)
+            status = issue_single(handle, g, alpha, beta, state.A[0], state.B[0], state.C[0]);
+        else if(constant_stride(state.A, state.sizes.a, stride_a)
+                && constant_stride(state.B, state.sizes.b, stride_b)
+                && constant_stride(state.C, state.sizes.c, stride_c) && stride_c > 0)
+            status = issue_strided(handle, g, alpha, beta, stride_a, stride_b, stride_c, count);
+        else
+        {
+            const void* const* A;
+            const void* const* B;
+            void* const*       C;
+            status = upload_pointers(handle, state, A, B, C);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = issue_batched(handle, g, alpha, beta, A, B, C, count);
+        }
+        issuing = false;
+
+        state.A.clear();
+        state.B.clear();
+        state.C.clear();
+        state.read_ranges.clear();
+        state.write_ranges.clear();
+        if(state.status == HIPBLAS_STATUS_SUCCESS)
+            state.status = status;
+        return status;
+    }
+
+    void issue_pending(hipblasHandle_t handle)
+    {
+        std::shared_ptr<hipblasDeferredGemms> state = find_deferred_gemms(handle);
+        if(state)
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            issue_pending(handle, *state);
+        }
+    }
+}
+
+bool hipblasDeferGemm(hipblasHandle_t handle, const hipblasDeferredGemm& gemm)
+{
+    if(issuing)
+        return false;
+    std::shared_ptr<hipblasDeferredGemms> state = find_deferred_gemms(handle);
+    if(!state)
+        return false;
+
+    // Invalid arguments and quick returns are left to the backend
+    hipblasGemmSizes sizes = gemm_sizes(gemm);
+    int              rows_a = gemm.transA == HIPBLAS_OP_N ? gemm.m : gemm.k;
+    int              cols_a = gemm.transA == HIPBLAS_OP_N ? gemm.k : gemm.m;
+    int              rows_b = gemm.transB == HIPBLAS_OP_N ? gemm.k : gemm.n;
+    int              cols_b = gemm.transB == HIPBLAS_OP_N ? gemm.n : gemm.k;
+    if(!sizes.scalar || gemm.m <= 0 || gemm.n <= 0 || gemm.k <= 0 || gemm.lda < rows_a
+       || gemm.ldb < rows_b || gemm.ldc < gemm.m || !gemm.alpha || !gemm.beta || !gemm.A
+       || !gemm.B || !gemm.C)
+        return false;
+
+    hipblasPointerMode_t mode;
+    if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+    bool device_mode = mode == HIPBLAS_POINTER_MODE_DEVICE;
+
+    auto range = [](const void* ptr, int rows, int cols, int ld, size_t elem_size) {
+        auto begin = static_cast<const char*>(ptr);
+        return hipblasMatrixRange{begin, begin + matrix_span(rows, cols, ld, elem_size)};
+    };
+    hipblasMatrixRange a = range(gemm.A, rows_a, cols_a, gemm.lda, sizes.a);
+    hipblasMatrixRange b = range(gemm.B, rows_b, cols_b, gemm.ldb, sizes.b);
+    hipblasMatrixRange c = range(gemm.C, gemm.m, gemm.n, gemm.ldc, sizes.c);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(!state->A.empty()
+       && (!state->matches(gemm, device_mode) || state->depends_on_pending(a, b, c)))
+        issue_pending(handle, *state);
+
+    if(state->A.empty())
+    {
+        state->key            = gemm;
+        state->sizes          = sizes;
+        state->device_scalars = device_mode;
+        if(!device_mode)
+        {
+            std::memcpy(state->alpha, gemm.alpha, sizes.scalar);
+            std::memcpy(state->beta, gemm.beta, sizes.scalar);
+        }
+    }
+    state->A.push_back(gemm.A);
+    state->B.push_back(gemm.B);
+    state->C.push_back(gemm.C);
+    state->read_ranges.push_back(a);
+    state->read_ranges.push_back(b);
+    state->write_ranges.push_back(c);
+
+    if(int(state->A.size()) >= state->max_batch_count)
+        issue_pending(handle, *state);
+    return true;
+}
+
+void hipblasFlushDeferredGemmsBefore(const char* function, hipblasHandle_t handle)
+{
+    if(issuing)
+        return;
+    if(function
+       && (!std::strcmp(function, "hipblasSgemm") || !std::strcmp(function, "hipblasGemmEx")
+           || !std::strcmp(function, "hipblasGemmEx_v2")))
+        return;
+
+    if(handle)
+    {
+        issue_pending(handle);
+        return;
+    }
+
+    // Functions without a handle, such as hipblasGetMatrix, may read the results
+    // of calls collected on any handle
+    std::vector<hipblasHandle_t> handles;
+    {
+        std::lock_guard<std::mutex> lock(handle_gemms_mutex);
+        for(auto& entry : handle_gemms)
+            handles.push_back(entry.first);
+    }
+    for(hipblasHandle_t h : handles)
+        issue_pending(h);
+}
+
+hipblasStatus_t hipblasEndDeferredGemms(hipblasHandle_t handle)
+{
+    std::shared_ptr<hipblasDeferredGemms> state = take_deferred_gemms(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    issue_pending(handle, *state);
+    return state->status;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasBeginDeferredBatching(hipblasHandle_t handle, int maxBatchCount)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    if(maxBatchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(handle_gemms_mutex);
+    auto&                       state = handle_gemms[handle];
+    if(!state)
+        state = std::make_shared<hipblasDeferredGemms>();
+    state->max_batch_count = maxBatchCount ? maxBatchCount : default_max_batch_count;
+    hipblas_layer_mode.fetch_or(HIPBLAS_LAYER_DEFERRED_GEMM);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasFlushDeferredBatching(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    std::shared_ptr<hipblasDeferredGemms> state = find_deferred_gemms(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    issue_pending(handle, *state);
+    hipblasStatus_t status = state->status;
+    state->status          = HIPBLAS_STATUS_SUCCESS;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasEndDeferredBatching(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    return hipblasEndDeferredGemms(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,372 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+// hipblasDSgesv factors A in single precision and refines the solution in double precision,
+// as LAPACK dsgesv does, with the exported getrf, getrs and gemm functions. hipBLAS has no
+// device kernels, so the conversions between precisions and the convergence test run on the
+// host. They move the n x n matrix once and n x nrhs values per refinement step, against the
+// O(n^3) double precision factorization they replace.
+namespace
+{
+    // Refinement steps before the solve falls back to a double precision factorization
+    constexpr int max_refinement_steps = 30;
+
+    // Sets the pointer mode of a handle to host for the duration of a call
+    class hipblasHostPointerMode
+    {
+        hipblasHandle_t      handle;
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+
+    public:
+        explicit hipblasHostPointerMode(hipblasHandle_t handle)
+            : handle(handle)
+        {
+            if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS)
+                mode = HIPBLAS_POINTER_MODE_HOST;
+            else if(mode != HIPBLAS_POINTER_MODE_HOST)
+                hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        }
+
+        ~hipblasHostPointerMode()
+        {
+            if(mode != HIPBLAS_POINTER_MODE_HOST)
+                hipblasSetPointerMode(handle, mode);
+        }
+
+        hipblasHostPointerMode(const hipblasHostPointerMode&) = delete;
+        hipblasHostPointerMode& operator=(const hipblasHostPointerMode&) = delete;
+    };
+
+    // Copies a rows x cols matrix on the stream of a handle. Copies to the host are complete
+    // on return.
+    template <typename T>
+    hipblasStatus_t copy_matrix(hipStream_t   stream,
+                                int           rows,
+                                int           cols,
+                                const T*      src,
+                                int           lds,
+                                T*            dst,
+                                int           ldd,
+                                hipMemcpyKind kind)
+    {
+        if(hipMemcpy2DAsync(dst,
+                            ldd * sizeof(T),
+                            src,
+                            lds * sizeof(T),
+                            rows * sizeof(T),
+                            cols,
+                            kind,
+                            stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(kind == hipMemcpyDeviceToHost && hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Returns false if a value is out of the range of float, which LAPACK also checks
+    bool to_single(const std::vector<double>& x, std::vector<float>& single, size_t size)
+    {
+        for(size_t i = 0; i < size; i++)
+        {
+            if(x[i] > FLT_MAX || x[i] < -FLT_MAX)
+                return false;
+            single[i] = float(x[i]);
+        }
+        return true;
+    }
+
+    // The infinity norm of an n x n matrix
+    double norm_inf(int n, const std::vector<double>& A)
+    {
+        std::vector<double> row_sums(n);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                row_sums[i] += std::abs(A[i + size_t(j) * n]);
+        return n ? *std::max_element(row_sums.begin(), row_sums.end()) : 0;
+    }
+
+    // True if the residual of each column of X is at most tolerance times the column
+    bool converged(int                        n,
+                   int                        nrhs,
+                   const std::vector<double>& R,
+                   const std::vector<double>& X,
+                   double                     tolerance)
+    {
+        for(int j = 0; j < nrhs; j++)
+        {
+            double r_norm = 0, x_norm = 0;
+            for(int i = 0; i < n; i++)
+            {
+                r_norm = std::max(r_norm, std::abs(R[i + size_t(j) * n]));
+                x_norm = std::max(x_norm, std::abs(X[i + size_t(j) * n]));
+            }
+            if(!(r_norm <= x_norm * tolerance))
+                return false;
+        }
+        return true;
+    }
+
+    // Solves with the single precision factorization and refines the solution. Sets iter to
+    // the number of refinement steps, or to the negative reason to fall back, as in dsgesv:
+    //   -2 - A, B or a residual is out of the range of float
+    //   -3 - the single precision factorization is singular
+    //   -31 - the solution did not converge in max_refinement_steps steps
+    hipblasStatus_t solve_refined(hipblasHandle_t handle,
+                                  hipStream_t     stream,
+                                  int             n,
+                                  int             nrhs,
+                                  double*         A,
+                                  int             lda,
+                                  int*            ipiv,
+                                  double*         B,
+                                  int             ldb,
+                                  double*         X,
+                                  int             ldx,
+                                  int&            iter)
+    {
+        const size_t a_size = size_t(n) * n;
+        const size_t x_size = size_t(n) * nrhs;
+
+        // R holds the residuals in double precision, SA and SX the matrix and right hand
+        // sides in single precision
+        hipblasDeviceScratch scratch;
+        void*                memory = scratch.allocate(
+            handle, x_size * sizeof(double) + (a_size + x_size) * sizeof(float) + sizeof(int));
+        if(!memory)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        double* R           = static_cast<double*>(memory);
+        float*  SA          = reinterpret_cast<float*>(R + x_size);
+        float*  SX          = SA + a_size;
+        int*    device_info = reinterpret_cast<int*>(SX + x_size);
+
+        std::vector<double> hA(a_size), hR(x_size), hX(x_size);
+        std::vector<float>  hS(std::max(a_size, x_size));
+
+        hipblasStatus_t status
+            = copy_matrix(stream, n, n, A, lda, hA.data(), n, hipMemcpyDeviceToHost);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        const double tolerance
+            = std::numeric_limits<double>::epsilon() * std::sqrt(double(n)) * norm_inf(n, hA);
+        if(!to_single(hA, hS, a_size))
+        {
+            iter = -2;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        status = copy_matrix(stream, n, n, hS.data(), n, SA, n, hipMemcpyHostToDevice);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        status = copy_matrix(stream, n, nrhs, B, ldb, hR.data(), n, hipMemcpyDeviceToHost);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(!to_single(hR, hS, x_size))
+        {
+            iter = -2;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        status = copy_matrix(stream, n, nrhs, hS.data(), n, SX, n, hipMemcpyHostToDevice);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        int info;
+        status = hipblasSgetrf(handle, n, SA, n, ipiv, device_info);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_matrix(stream, 1, 1, device_info, 1, &info, 1, hipMemcpyDeviceToHost);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(info > 0)
+        {
+            iter = -3;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        const double minus_one = -1.0, one = 1.0;
+        for(iter = 0;; iter++)
+        {
+            // Solves for the first solution or the correction to it in single precision
+            status = hipblasSgetrs(handle, HIPBLAS_OP_N, n, nrhs, SA, n, ipiv, SX, n, &info);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = copy_matrix(stream, n, nrhs, SX, n, hS.data(), n, hipMemcpyDeviceToHost);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            for(size_t i = 0; i < x_size; i++)
+                hX[i] = iter ? hX[i] + hS[i] : hS[i];
+
+            // R = B - A*X in double precision
+            status = copy_matrix(stream, n, nrhs, hX.data(), n, X, ldx, hipMemcpyHostToDevice);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = copy_matrix(stream, n, nrhs, B, ldb, R, n, hipMemcpyDeviceToDevice);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasDgemm(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      n,
+                                      nrhs,
+                                      n,
+                                      &minus_one,
+                                      A,
+                                      lda,
+                                      X,
+                                      ldx,
+                                      &one,
+                                      R,
+                                      n);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = copy_matrix(stream, n, nrhs, R, n, hR.data(), n, hipMemcpyDeviceToHost);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            if(converged(n, nrhs, hR, hX, tolerance))
+                return HIPBLAS_STATUS_SUCCESS;
+            if(iter == max_refinement_steps)
+            {
+                iter = -max_refinement_steps - 1;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+            if(!to_single(hR, hS, x_size))
+            {
+                iter = -2;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+            status = copy_matrix(stream, n, nrhs, hS.data(), n, SX, n, hipMemcpyHostToDevice);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+    }
+
+    // Solves with a double precision factorization of A, which overwrites A
+    hipblasStatus_t solve_double(hipblasHandle_t handle,
+                                 hipStream_t     stream,
+                                 int             n,
+                                 int             nrhs,
+                                 double*         A,
+                                 int             lda,
+                                 int*            ipiv,
+                                 double*         B,
+                                 int             ldb,
+                                 double*         X,
+                                 int             ldx,
+                                 int*            info)
+    {
+        hipblasDeviceScratch scratch;
+        int*                 device_info = static_cast<int*>(scratch.allocate(handle, sizeof(int)));
+        if(!device_info)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        hipblasStatus_t status = hipblasDgetrf(handle, n, A, lda, ipiv, device_info);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_matrix(stream, 1, 1, device_info, 1, info, 1, hipMemcpyDeviceToHost);
+        if(status != HIPBLAS_STATUS_SUCCESS || *info > 0)
+            return status;
+
+        status = copy_matrix(stream, n, nrhs, B, ldb, X, ldx, hipMemcpyDeviceToDevice);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipblasDgetrs(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, X, ldx, info);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              double*         A,
+                              const int       lda,
+                              int*            ipiv,
+                              double*         B,
+                              const int       ldb,
+                              double*         X,
+                              const int       ldx,
+                              int*            iter,
+                              int*            info)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -1;
+    else if(nrhs < 0)
+        *info = -2;
+    else if(A == NULL && n)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(ipiv == NULL && n)
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if((X == NULL || X == B) && n * nrhs)
+        *info = -8;
+    else if(ldx < std::max(1, n))
+        *info = -9;
+    else if(iter == NULL)
+        *info = -10;
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *iter = 0;
+    if(!n || !nrhs)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // The matrices are copied outside of hipBLAS calls, after any gemm calls collected on the
+    // handle that write them
+    hipblasFlushDeferredGemms(handle);
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasHostPointerMode pointer_mode(handle);
+
+    status = solve_refined(handle, stream, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, *iter);
+    if(status != HIPBLAS_STATUS_SUCCESS || *iter >= 0)
+        return status;
+    return solve_double(handle, stream, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
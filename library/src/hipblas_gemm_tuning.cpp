@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gemm_tuning.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace
+{
+    class hipblasGemmTuningDatabase
+    {
+        std::mutex                                                              mutex;
+        std::unordered_map<hipblasGemmTuningKey, int32_t, hipblasGemmTuningKeyHash> solutions;
+        std::string path; // empty if results are kept in memory only
+
+        void load()
+        {
+            std::ifstream file(path);
+            std::string   line;
+            while(std::getline(file, line))
+            {
+                if(line.empty() || line[0] == '#')
+                    continue;
+
+                std::istringstream   fields(line);
+                hipblasGemmTuningKey key;
+                int32_t              solution_index;
+                double               time_us;
+                fields >> key.arch;
+                for(int64_t& arg : key.args)
+                    fields >> arg;
+                fields >> solution_index >> time_us;
+                if(fields && solution_index >= 0)
+                    solutions[key] = solution_index;
+            }
+        }
+
+    public:
+        hipblasGemmTuningDatabase()
+        {
+            const char* env  = std::getenv("HIPBLAS_GEMM_TUNING_DB");
+            const char* home = std::getenv("HOME");
+            if(env && *env)
+                path = env;
+            else if(home && *home)
+                path = std::string(home) + "/.hipblas_gemm_tuning";
+            if(!path.empty())
+                load();
+        }
+
+        bool find(const hipblasGemmTuningKey& key, int32_t& solution_index)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        it = solutions.find(key);
+            if(it == solutions.end())
+                return false;
+            solution_index = it->second;
+            return true;
+        }
+
+        void add(const hipblasGemmTuningKey& key, int32_t solution_index, double time_us)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!solutions.emplace(key, solution_index).second || path.empty())
+                return;
+
+            // Other processes may append to the same file, so each line is written at once
+            std::ostringstream line;
+            line << key.arch;
+            for(int64_t arg : key.args)
+                line << ' ' << arg;
+            line << ' ' << solution_index << ' ' << time_us << '\n';
+
+            std::ofstream file(path, std::ios::app);
+            if(!(file << line.str() << std::flush))
+            {
+                std::fprintf(stderr,
+                             "hipBLAS: cannot write gemm tuning database %s, keeping results "
+                             "in memory\n",
+                             path.c_str());
+                path.clear();
+            }
+        }
+    };
+
+    hipblasGemmTuningDatabase& tuning_database()
+    {
+        static hipblasGemmTuningDatabase database;
+        return database;
+    }
+}
+
+bool hipblasGemmTuningEnabled()
+{
+    static const bool enabled = [] {
+        const char* env = std::getenv("HIPBLAS_GEMM_TUNING");
+        return env && std::atoi(env) != 0;
+    }();
+    return enabled;
+}
+
+bool hipblasFindTunedGemm(const hipblasGemmTuningKey& key, int32_t& solution_index)
+{
+    return tuning_database().find(key, solution_index);
+}
+
+void hipblasAddTunedGemm(const hipblasGemmTuningKey& key, int32_t solution_index, double time_us)
+{
+    tuning_database().add(key, solution_index, time_us);
+}
@@ -0,0 +1,265 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    struct hipblasHandlePool
+    {
+        std::mutex mutex;
+
+        // Device of each handle that is acquired
+        std::unordered_map<hipblasHandle_t, int> acquired;
+
+        // Idle handles of each device, the most recently released last
+        std::unordered_map<int, std::vector<hipblasHandle_t>> idle;
+    };
+
+    // Never destroyed, so that handles of threads exiting during process exit can still be
+    // released, and so that no handle is destroyed after the HIP runtime is torn down
+    hipblasHandlePool& handle_pool()
+    {
+        static hipblasHandlePool* pool = new hipblasHandlePool;
+        return *pool;
+    }
+
+    // Device 0 when HIP reports no device, as for the host backend
+    int current_device()
+    {
+        int device;
+        return hipGetDevice(&device) == hipSuccess ? device : 0;
+    }
+
+    hipblasStatus_t create_handle(int device, hipblasHandle_t* handle)
+    {
+        int current = current_device();
+        if(device != current && hipSetDevice(device) != hipSuccess)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasStatus_t status = hipblasCreate(handle);
+        if(device != current)
+            (void)hipSetDevice(current);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Pooled handles all start with the modes a released handle is reset to
+        status = hipblasResetHandleModes(*handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasDestroy(*handle);
+            *handle = nullptr;
+        }
+        return status;
+    }
+
+    hipblasStatus_t acquire_handle(hipblasHandle_t* handle, int device, hipStream_t stream)
+    {
+        hipblasHandlePool& pool = handle_pool();
+        *handle                 = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            auto&                       idle = pool.idle[device];
+            if(!idle.empty())
+            {
+                *handle = idle.back();
+                idle.pop_back();
+                pool.acquired[*handle] = device;
+            }
+        }
+
+        if(!*handle)
+        {
+            // Created outside the lock, as creation is what the pool saves
+            hipblasStatus_t status = create_handle(device, handle);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            pool.acquired[*handle] = device;
+        }
+
+        hipblasStatus_t status = hipblasSetStream(*handle, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(*handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            {
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                pool.acquired.erase(*handle);
+            }
+            hipblasDestroy(*handle);
+            *handle = nullptr;
+        }
+        return status;
+    }
+
+    hipblasStatus_t release_handle(hipblasHandle_t handle)
+    {
+        hipblasHandlePool& pool = handle_pool();
+        int                device;
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            auto                        it = pool.acquired.find(handle);
+            if(it == pool.acquired.end())
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            device = it->second;
+            pool.acquired.erase(it);
+        }
+
+        // Leave nothing of the previous user on the handle but its device memory
+        hipblasStatus_t status = hipblasEndDeferredBatching(handle);
+        if(hipblasGetHandleState(handle)->get_user_workspace().allocator.custom())
+        {
+            hipblasStatus_t reset_status = hipblasSetAllocator(handle, nullptr, nullptr, nullptr);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = reset_status;
+        }
+        hipblasStatus_t modes_status = hipblasResetHandleModes(handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = modes_status;
+        hipblasClearPointerArrays(handle);
+        hipblasResetHandleStatistics(handle);
+        hipblasSetStream(handle, nullptr);
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.idle[device].push_back(handle);
+        return status;
+    }
+
+    // Handle of a thread from hipblasGetThreadHandle, released when the thread exits
+    struct hipblasThreadHandle
+    {
+        hipblasHandle_t handle = nullptr;
+        int             device = -1;
+
+        ~hipblasThreadHandle()
+        {
+            if(handle)
+                release_handle(handle);
+        }
+    };
+
+    thread_local hipblasThreadHandle thread_handle;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasAcquireHandle(hipblasHandle_t* handle, int device, hipStream_t stream)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    // Without a device, as for the host backend, the only device is 0
+    int device_count = 0;
+    if(hipGetDeviceCount(&device_count) != hipSuccess || device_count < 1)
+        device_count = 1;
+    if(device == -1)
+        device = current_device();
+    if(device < 0 || device >= device_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return acquire_handle(handle, device, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasReleaseHandle(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    if(handle == thread_handle.handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return release_handle(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetThreadHandle(hipblasHandle_t* handle, hipStream_t stream)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    int device = current_device();
+    if(thread_handle.handle && thread_handle.device == device)
+    {
+        *handle = thread_handle.handle;
+        return hipblasSetStream(*handle, stream);
+    }
+
+    if(thread_handle.handle)
+    {
+        release_handle(thread_handle.handle);
+        thread_handle.handle = nullptr;
+    }
+
+    hipblasStatus_t status = acquire_handle(&thread_handle.handle, device, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        thread_handle.device = device;
+    *handle = thread_handle.handle;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasClearHandlePool(void)
+try
+{
+    hipblasHandlePool&           pool = handle_pool();
+    std::vector<hipblasHandle_t> handles;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        for(auto& entry : pool.idle)
+            handles.insert(handles.end(), entry.second.begin(), entry.second.end());
+        pool.idle.clear();
+    }
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(hipblasHandle_t handle : handles)
+    {
+        hipblasStatus_t destroy_status = hipblasDestroy(handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = destroy_status;
+    }
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle_state.hpp"
+#include "deferred.hpp"
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <shared_mutex>
+
+namespace
+{
+    std::shared_mutex handle_states_mutex;
+    std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasHandleState>> handle_states;
+}
+
+size_t hipblasHandleState::get_workspace_size(const hipblasWorkspaceKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = workspace_sizes.find(key);
+    return it == workspace_sizes.end() ? 0 : it->second;
+}
+
+void hipblasHandleState::set_workspace_size(const hipblasWorkspaceKey& key, size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    workspace_sizes[key] = size;
+}
+
+void hipblasHandleState::add_call_statistics(const char* function,
+                                             double      flops,
+                                             double      bytes,
+                                             int64_t     duration_ns)
+{
+    // Bucket 0 holds calls under 1 us, bucket i calls in [2^(i-1), 2^i) us
+    int     bucket = 0;
+    int64_t us     = duration_ns / 1000;
+    while(us && bucket < HIPBLAS_LATENCY_HISTOGRAM_BUCKETS - 1)
+    {
+        us >>= 1;
+        bucket++;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = statistics.find(function);
+    if(it == statistics.end())
+    {
+        hipblasFunctionStatistics entry = {};
+        entry.function                  = function;
+        it                              = statistics.emplace(function, entry).first;
+    }
+    it->second.callCount++;
+    it->second.flops += flops;
+    it->second.bytes += bytes;
+    it->second.totalTimeUs += duration_ns * 1e-3;
+    it->second.latencyHistogram[bucket]++;
+}
+
+std::vector<hipblasFunctionStatistics> hipblasHandleState::get_statistics()
+{
+    std::lock_guard<std::mutex>            lock(mutex);
+    std::vector<hipblasFunctionStatistics> entries;
+    entries.reserve(statistics.size());
+    for(auto& entry : statistics)
+        entries.push_back(entry.second);
+    return entries;
+}
+
+void hipblasHandleState::reset_statistics()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    statistics.clear();
+}
+
+hipblasUserWorkspace hipblasHandleState::get_user_workspace()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return user_workspace;
+}
+
+hipblasUserWorkspace
+    hipblasHandleState::exchange_user_workspace(const hipblasUserWorkspace& workspace)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    hipblasUserWorkspace        previous = user_workspace;
+    user_workspace                       = workspace;
+    return previous;
+}
+
+void* hipblasDeviceAllocator::allocate(size_t size, hipStream_t stream) const
+{
+    if(custom())
+        return device_malloc(user_data, size, stream);
+
+    void* ptr = nullptr;
+    return hipMalloc(&ptr, size) == hipSuccess ? ptr : nullptr;
+}
+
+void hipblasDeviceAllocator::free(void* ptr, hipStream_t stream) const
+{
+    if(!ptr)
+        return;
+    if(custom())
+        device_free(user_data, ptr, stream);
+    else
+        (void)hipFree(ptr);
+}
+
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(handle_states_mutex);
+        auto                                it = handle_states.find(handle);
+        if(it != handle_states.end())
+            return it->second.get();
+    }
+
+    std::unique_lock<std::shared_mutex> lock(handle_states_mutex);
+    auto&                               state = handle_states[handle];
+    if(!state)
+        state = std::make_unique<hipblasHandleState>();
+    return state.get();
+}
+
+void hipblasDestroyHandleState(hipblasHandle_t handle)
+{
+    hipblasEndDeferredGemms(handle);
+    hipblasClearPointerArrays(handle);
+
+    std::unique_lock<std::shared_mutex> lock(handle_states_mutex);
+    handle_states.erase(handle);
+}
+
+void* hipblasDeviceScratch::allocate(hipblasHandle_t handle, size_t size)
+{
+    allocator.free(memory, stream);
+    memory = nullptr;
+
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return nullptr;
+    allocator = hipblasGetHandleState(handle)->get_user_workspace().allocator;
+    memory    = allocator.allocate(size, stream);
+    return memory;
+}
@@ -0,0 +1,999 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "logging.hpp"
+#include "exceptions.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+std::atomic<uint32_t> hipblas_layer_mode{HIPBLAS_LAYER_NONE};
+
+struct hipblasCallbacks
+{
+    hipblasCallback_t pre_call;
+    hipblasCallback_t post_call;
+    void*             user_data;
+};
+
+namespace
+{
+    int64_t steady_clock_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // Single-producer single-consumer ring of call records. Each calling thread
+    // owns one ring and is its only producer; the flush thread is the only consumer.
+    // A full ring drops the record rather than blocking the caller.
+    class hipblasCallRing
+    {
+        static constexpr size_t capacity = 1024; // must be a power of two
+
+        hipblasCallRecord                records[capacity];
+        alignas(64) std::atomic<size_t>  head{0};
+        alignas(64) std::atomic<size_t>  tail{0};
+
+    public:
+        std::atomic<size_t> dropped{0};
+        std::atomic<bool>   orphaned{false}; // set when the owning thread exits
+
+        void push(const hipblasCallRecord& record)
+        {
+            size_t h = head.load(std::memory_order_relaxed);
+            if(h - tail.load(std::memory_order_acquire) == capacity)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            records[h & (capacity - 1)] = record;
+            head.store(h + 1, std::memory_order_release);
+        }
+
+        template <typename F>
+        void drain(F&& func)
+        {
+            size_t t = tail.load(std::memory_order_relaxed);
+            size_t h = head.load(std::memory_order_acquire);
+            for(; t != h; t++)
+                func(records[t & (capacity - 1)]);
+            tail.store(t, std::memory_order_release);
+        }
+
+        bool empty() const
+        {
+            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+        }
+    };
+
+    /***************************************************************************
+     * Formatting
+     **************************************************************************/
+
+    // Backends name some arguments differently from hipblas.h
+    const char* canonical_arg_name(const std::string& name)
+    {
+        static const struct
+        {
+            const char* alias;
+            const char* name;
+        } aliases[] = {
+            {"transa", "transA"},          {"transb", "transB"},
+            {"a_type", "aType"},           {"b_type", "bType"},
+            {"c_type", "cType"},           {"compute_type", "computeType"},
+            {"stride_a", "strideA"},       {"stride_A", "strideA"},
+            {"strideAP", "strideA"},       {"bsa", "strideA"},
+            {"stride_b", "strideB"},       {"stride_B", "strideB"},
+            {"bsb", "strideB"},            {"stride_c", "strideC"},
+            {"stride_C", "strideC"},       {"bsc", "strideC"},
+            {"stride_x", "stridex"},       {"stride_y", "stridey"},
+            {"stride_x1", "stridex1"},     {"stride_y1", "stridey1"},
+            {"stride_d1", "strided1"},     {"stride_d2", "strided2"},
+            {"stride_s", "strides"},       {"invA_size", "invAsize"},
+            {"batch_count", "batchCount"}, {"group_count", "groupCount"},
+        };
+        for(auto& a : aliases)
+            if(name == a.alias)
+                return a.name;
+        return nullptr;
+    }
+
+    const char* precision_string(char precision)
+    {
+        switch(precision)
+        {
+        case 'h':
+            return "f16_r";
+        case 's':
+            return "f32_r";
+        case 'd':
+            return "f64_r";
+        case 'c':
+            return "f32_c";
+        case 'z':
+            return "f64_c";
+        }
+        return "invalid";
+    }
+
+    const char* datatype_string(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return "f16_r";
+        case HIPBLAS_R_32F:
+            return "f32_r";
+        case HIPBLAS_R_64F:
+            return "f64_r";
+        case HIPBLAS_C_16F:
+            return "f16_c";
+        case HIPBLAS_C_32F:
+            return "f32_c";
+        case HIPBLAS_C_64F:
+            return "f64_c";
+        case HIPBLAS_R_8I:
+            return "i8_r";
+        case HIPBLAS_R_8U:
+            return "u8_r";
+        case HIPBLAS_R_32I:
+            return "i32_r";
+        case HIPBLAS_R_32U:
+            return "u32_r";
+        case HIPBLAS_C_8I:
+            return "i8_c";
+        case HIPBLAS_C_8U:
+            return "u8_c";
+        case HIPBLAS_C_32I:
+            return "i32_c";
+        case HIPBLAS_C_32U:
+            return "u32_c";
+        case HIPBLAS_R_16B:
+            return "bf16_r";
+        case HIPBLAS_C_16B:
+            return "bf16_c";
+        default:
+            return "invalid";
+        }
+    }
+
+    const char* hip_datatype_string(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            return "f16_r";
+        case HIP_R_32F:
+            return "f32_r";
+        case HIP_R_64F:
+            return "f64_r";
+        case HIP_C_16F:
+            return "f16_c";
+        case HIP_C_32F:
+            return "f32_c";
+        case HIP_C_64F:
+            return "f64_c";
+        case HIP_R_8I:
+            return "i8_r";
+        case HIP_R_8U:
+            return "u8_r";
+        case HIP_R_32I:
+            return "i32_r";
+        case HIP_R_32U:
+            return "u32_r";
+        case HIP_C_8I:
+            return "i8_c";
+        case HIP_C_8U:
+            return "u8_c";
+        case HIP_C_32I:
+            return "i32_c";
+        case HIP_C_32U:
+            return "u32_c";
+        case HIP_R_16BF:
+            return "bf16_r";
+        case HIP_C_16BF:
+            return "bf16_c";
+        default:
+            return "invalid";
+        }
+    }
+
+    const char* compute_type_string(hipblasComputeType_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_COMPUTE_16F:
+            return "c16f";
+        case HIPBLAS_COMPUTE_16F_PEDANTIC:
+            return "c16f_pedantic";
+        case HIPBLAS_COMPUTE_32F:
+            return "c32f";
+        case HIPBLAS_COMPUTE_32F_PEDANTIC:
+            return "c32f_pedantic";
+        case HIPBLAS_COMPUTE_32F_FAST_16F:
+            return "c32f_fast_16f";
+        case HIPBLAS_COMPUTE_32F_FAST_16BF:
+            return "c32f_fast_16bf";
+        case HIPBLAS_COMPUTE_32F_FAST_TF32:
+            return "c32f_fast_tf32";
+        case HIPBLAS_COMPUTE_64F:
+            return "c64f";
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+            return "c64f_pedantic";
+        case HIPBLAS_COMPUTE_32I:
+            return "c32i";
+        case HIPBLAS_COMPUTE_32I_PEDANTIC:
+            return "c32i_pedantic";
+        default:
+            return "invalid";
+        }
+    }
+
+    // Value of an argument as hipblas-bench spells it
+    std::string arg_value_string(hipblasArgKind kind, int64_t value)
+    {
+        switch(kind)
+        {
+        case hipblasArgKind::operation:
+            return value == HIPBLAS_OP_N ? "N" : value == HIPBLAS_OP_T ? "T" : "C";
+        case hipblasArgKind::fill:
+            return value == HIPBLAS_FILL_MODE_UPPER   ? "U"
+                   : value == HIPBLAS_FILL_MODE_LOWER ? "L"
+                                                      : "F";
+        case hipblasArgKind::diagonal:
+            return value == HIPBLAS_DIAG_UNIT ? "U" : "N";
+        case hipblasArgKind::side:
+            return value == HIPBLAS_SIDE_LEFT ? "L" : value == HIPBLAS_SIDE_RIGHT ? "R" : "B";
+        case hipblasArgKind::datatype:
+            return datatype_string(hipblasDatatype_t(value));
+        case hipblasArgKind::hip_datatype:
+            return hip_datatype_string(hipDataType(value));
+        case hipblasArgKind::compute_type:
+            return compute_type_string(hipblasComputeType_t(value));
+        default:
+            return std::to_string(value);
+        }
+    }
+
+    void append_trace(std::string& out, const hipblasCallRecord& record)
+    {
+        std::vector<std::string> names = hipblasGetRecordArgNames(record);
+
+        out += record.function;
+        for(int i = 0; i < record.num_args; i++)
+        {
+            out += ',';
+            out += names[i];
+            out += '=';
+            out += arg_value_string(record.kinds[i], record.values[i]);
+        }
+
+        char time[64];
+        std::snprintf(time, sizeof(time), ",time_us=%.3f\n", record.duration_ns * 1e-3);
+        out += time;
+    }
+
+    // hipblas-bench option for an argument, or nullptr if it has none
+    const char* bench_option(const std::string& name)
+    {
+        static const struct
+        {
+            const char* name;
+            const char* option;
+        } options[] = {
+            {"transA", "--transposeA"}, {"trans", "--transposeA"}, {"transB", "--transposeB"},
+            {"side", "--side"},         {"uplo", "--uplo"},        {"diag", "--diag"},
+            {"m", "-m"},                {"n", "-n"},               {"k", "-k"},
+            {"nrhs", "-k"},             {"kl", "--kl"},            {"ku", "--ku"},
+            {"lda", "--lda"},           {"ldb", "--ldb"},          {"ldc", "--ldc"},
+            {"ldd", "--ldd"},           {"incx", "--incx"},        {"incy", "--incy"},
+            {"strideA", "--stride_a"},  {"strideB", "--stride_b"}, {"strideC", "--stride_c"},
+            {"stridex", "--stride_x"},  {"stridey", "--stride_y"}, {"batchCount", "--batch_count"},
+            {"algo", "--algo"},         {"flags", "--flags"},
+        };
+        for(auto& o : options)
+            if(name == o.name)
+                return o.option;
+        return nullptr;
+    }
+
+    // A hipblas-bench command line option and its value
+    typedef std::pair<const char*, std::string> hipblasBenchArg;
+
+    // hipblas-bench function name and the options, such as precision, that
+    // follow from the function name. Returns false for functions hipblas-bench
+    // cannot run.
+    bool bench_function(const char*                   function,
+                        std::string&                  bench_name,
+                        std::vector<hipblasBenchArg>& args)
+    {
+        hipblasFunctionName name;
+        if(!hipblasParseFunctionName(function, name) || (!name.precision && !name.ex))
+            return false;
+
+        // Per-group sizes cannot be given on the command line
+        if(!std::strcmp(name.batch, "_grouped"))
+            return false;
+
+        // Neither is the epilogue descriptor, which is not recorded
+        if(name.epilogue)
+            return false;
+
+        bench_name = name.base + name.batch + (name.ex ? "_ex" : "");
+        if(name.precision)
+            args.emplace_back("-r", precision_string(name.precision));
+        if(name.real_precision)
+        {
+            args.emplace_back("--b_type", precision_string(name.real_precision));
+            if(name.real_c)
+                args.emplace_back("--c_type", precision_string(name.real_precision));
+        }
+        if(name.scalar_arrays)
+            args.emplace_back("--with_scalar_arrays", "1");
+        if(name.api_64)
+            args.emplace_back("--api", "2");
+        return true;
+    }
+
+    // hipblas-bench function and options that repeat the call of record.
+    // Returns false for functions hipblas-bench cannot run.
+    bool bench_args(const hipblasCallRecord&      record,
+                    std::string&                  function,
+                    std::vector<hipblasBenchArg>& args)
+    {
+        if(!bench_function(record.function, function, args))
+            return false;
+
+        std::vector<std::string> names = hipblasGetRecordArgNames(record);
+
+        // Data types of _ex functions are given in argument order, except for the
+        // compute type
+        static const char* type_options[] = {"--a_type", "--b_type", "--c_type", "--d_type"};
+        int                num_types      = 0;
+
+        for(int i = 0; i < record.num_args; i++)
+        {
+            hipblasArgKind kind   = record.kinds[i];
+            const char*    option = nullptr;
+            if(kind == hipblasArgKind::compute_type)
+                option = "--compute_type_gemm";
+            else if(kind == hipblasArgKind::datatype || kind == hipblasArgKind::hip_datatype)
+            {
+                if(names[i] == "computeType" || names[i] == "executionType")
+                    option = "--compute_type";
+                else if(num_types < 4)
+                    option = type_options[num_types++];
+            }
+            else
+                option = bench_option(names[i]);
+
+            if(option)
+                args.emplace_back(option, arg_value_string(kind, record.values[i]));
+        }
+        return true;
+    }
+
+    void append_bench(std::string& out, const hipblasCallRecord& record)
+    {
+        std::string                  function;
+        std::vector<hipblasBenchArg> args;
+        if(!bench_args(record, function, args))
+            return;
+
+        out += "hipblas-bench -f ";
+        out += function;
+        for(auto& arg : args)
+        {
+            out += ' ';
+            out += arg.first;
+            out += ' ';
+            out += arg.second;
+        }
+        out += '\n';
+    }
+
+    // Appends the call of record as an entry of the Tests list of a hipblas-bench
+    // yaml file. Returns false for functions hipblas-bench cannot run.
+    bool append_yaml_test(std::string& out, const hipblasCallRecord& record)
+    {
+        std::string                  function;
+        std::vector<hipblasBenchArg> args;
+        if(!bench_args(record, function, args))
+            return false;
+
+        // Arguments in hipblas_common.yaml, in the order of the command line
+        std::vector<std::pair<std::string, std::string>> yaml_args;
+        auto set_arg = [&yaml_args](const std::string& key, const std::string& value) {
+            for(auto& arg : yaml_args)
+                if(arg.first == key)
+                {
+                    arg.second = value;
+                    return;
+                }
+            yaml_args.emplace_back(key, value);
+        };
+
+        static const struct
+        {
+            const char* option;
+            const char* key;
+        } keys[] = {
+            {"-m", "M"},
+            {"-n", "N"},
+            {"-k", "K"},
+            {"--kl", "KL"},
+            {"--ku", "KU"},
+            {"--transposeA", "transA"},
+            {"--transposeB", "transB"},
+        };
+
+        for(auto& arg : args)
+        {
+            std::string option = arg.first;
+            if(option == "-r")
+            {
+                for(const char* key : {"a_type", "b_type", "c_type", "d_type", "compute_type"})
+                    set_arg(key, arg.second);
+                continue;
+            }
+            if(option == "--with_scalar_arrays")
+                set_arg("with_scalar_arrays", "true");
+            else if(option == "--api")
+                set_arg("api", "C_64");
+            else
+            {
+                std::string key = option.substr(2);
+                for(auto& k : keys)
+                    if(option == k.option)
+                        key = k.key;
+                set_arg(key, arg.second);
+            }
+        }
+
+        out += "  - { function: ";
+        out += function;
+        for(auto& arg : yaml_args)
+        {
+            out += ", ";
+            out += arg.first;
+            out += ": ";
+            out += arg.second;
+        }
+        out += " }\n";
+        return true;
+    }
+
+    /***************************************************************************
+     * Shape histogram
+     **************************************************************************/
+
+    // A function together with the integer and enum arguments of a call to it
+    struct hipblasShapeKey
+    {
+        const char*                                      function;
+        std::array<int64_t, hipblasCallRecord::max_args> values;
+
+        bool operator==(const hipblasShapeKey& rhs) const
+        {
+            return function == rhs.function && values == rhs.values;
+        }
+    };
+
+    struct hipblasShapeKeyHash
+    {
+        size_t operator()(const hipblasShapeKey& key) const
+        {
+            uint64_t hash = uint64_t(uintptr_t(key.function));
+            for(int64_t value : key.values)
+                hash = (hash ^ uint64_t(value)) * 0x100000001b3ull;
+            return size_t(hash);
+        }
+    };
+
+    struct hipblasShapeCount
+    {
+        hipblasCallRecord record; // the first call with the shape
+        uint64_t          count = 0;
+    };
+
+    // Number of calls with each shape, counted when HIPBLAS_LAYER_SHAPES is set
+    class hipblasShapeHistogram
+    {
+        std::mutex                                                                   mutex;
+        std::unordered_map<hipblasShapeKey, hipblasShapeCount, hipblasShapeKeyHash> shapes;
+
+    public:
+        void add(const hipblasCallRecord& record)
+        {
+            hipblasShapeKey key = {record.function, {}};
+            std::copy(record.values, record.values + record.num_args, key.values.begin());
+
+            std::lock_guard<std::mutex> lock(mutex);
+            hipblasShapeCount&          shape = shapes[key];
+            if(!shape.count++)
+                shape.record = record;
+        }
+
+        // Writes the max_shapes most frequent shapes that hipblas-bench can run, as a
+        // yaml file for hipblas-bench --yaml
+        bool write(const char* path, int max_shapes)
+        {
+            std::vector<hipblasShapeCount> sorted;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                sorted.reserve(shapes.size());
+                for(auto& shape : shapes)
+                    sorted.push_back(shape.second);
+            }
+            std::stable_sort(sorted.begin(),
+                             sorted.end(),
+                             [](const hipblasShapeCount& a, const hipblasShapeCount& b) {
+                                 return a.count > b.count;
+                             });
+
+            std::string out = "---\ninclude: hipblas_common.yaml\n\n"
+                              "# Most frequent hipBLAS call shapes, with their call counts\n\n"
+                              "Tests:\n";
+            int written = 0;
+            for(auto& shape : sorted)
+            {
+                if(written == max_shapes)
+                    break;
+                std::string test;
+                if(!append_yaml_test(test, shape.record))
+                    continue;
+                out += "  # " + std::to_string(shape.count) + " calls\n" + test;
+                written++;
+            }
+
+            FILE* file = path ? std::fopen(path, "w") : stderr;
+            if(!file)
+                return false;
+            std::fwrite(out.data(), 1, out.size(), file);
+            if(file == stderr)
+                std::fflush(file);
+            else
+                std::fclose(file);
+            return true;
+        }
+    };
+
+    hipblasShapeHistogram shape_histogram;
+
+    // Path and number of shapes written at exit, from HIPBLAS_LOG_SHAPES_PATH and
+    // HIPBLAS_LOG_SHAPES_TOP
+    const char* default_shapes_path()
+    {
+        const char* path = std::getenv("HIPBLAS_LOG_SHAPES_PATH");
+        return path && *path ? path : nullptr;
+    }
+
+    int default_max_shapes()
+    {
+        const char* env = std::getenv("HIPBLAS_LOG_SHAPES_TOP");
+        int         top = env ? std::atoi(env) : 0;
+        return top > 0 ? top : 100;
+    }
+
+    /***************************************************************************
+     * Logger
+     **************************************************************************/
+
+    FILE* open_log_file(const char* env)
+    {
+        const char* path = std::getenv(env);
+        if(path && *path)
+        {
+            FILE* file = std::fopen(path, "w");
+            if(file)
+                return file;
+            std::fprintf(stderr, "hipBLAS: cannot open %s=%s, logging to stderr\n", env, path);
+        }
+        return stderr;
+    }
+
+    class hipblasLogger
+    {
+        std::mutex                                    mutex; // guards rings
+        std::vector<std::shared_ptr<hipblasCallRing>> rings;
+        std::condition_variable                       wake;
+        bool                                          stop   = false;
+        FILE*                                         trace  = nullptr;
+        FILE*                                         bench  = nullptr;
+        bool                                          shapes = false;
+        std::thread                                   flusher;
+
+        // Drains every ring and writes the formatted records
+        void flush()
+        {
+            std::string trace_out, bench_out;
+            size_t      dropped = 0;
+
+            std::vector<std::shared_ptr<hipblasCallRing>> snapshot;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                snapshot = rings;
+            }
+
+            for(auto& ring : snapshot)
+            {
+                ring->drain([&](const hipblasCallRecord& record) {
+                    if(trace)
+                        append_trace(trace_out, record);
+                    if(bench)
+                        append_bench(bench_out, record);
+                });
+                dropped += ring->dropped.exchange(0, std::memory_order_relaxed);
+            }
+
+            if(dropped)
+            {
+                char note[96];
+                std::snprintf(note,
+                              sizeof(note),
+                              "# hipBLAS: %zu calls were not logged because the buffer was full\n",
+                              dropped);
+                (trace ? trace_out : bench_out) += note;
+            }
+
+            if(trace && !trace_out.empty())
+            {
+                std::fwrite(trace_out.data(), 1, trace_out.size(), trace);
+                std::fflush(trace);
+            }
+            if(bench && !bench_out.empty())
+            {
+                std::fwrite(bench_out.data(), 1, bench_out.size(), bench);
+                std::fflush(bench);
+            }
+
+            // Rings of exited threads are released once they are empty
+            std::lock_guard<std::mutex> lock(mutex);
+            for(size_t i = 0; i < rings.size();)
+            {
+                if(rings[i]->orphaned.load() && rings[i]->empty())
+                {
+                    rings[i] = rings.back();
+                    rings.pop_back();
+                }
+                else
+                    i++;
+            }
+        }
+
+        void flush_loop()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(!stop)
+            {
+                wake.wait_for(lock, std::chrono::milliseconds(100));
+                lock.unlock();
+                flush();
+                lock.lock();
+            }
+        }
+
+    public:
+        hipblasLogger()
+        {
+            const char* env  = std::getenv("HIPBLAS_LAYER");
+            uint32_t    mode = env ? uint32_t(std::strtoul(env, nullptr, 0)) : 0;
+            mode &= HIPBLAS_LAYER_ENV_MASK;
+
+            if(mode & HIPBLAS_LAYER_TRACE)
+                trace = open_log_file("HIPBLAS_LOG_TRACE_PATH");
+            if(mode & HIPBLAS_LAYER_BENCH)
+                bench = open_log_file("HIPBLAS_LOG_BENCH_PATH");
+
+            shapes = mode & HIPBLAS_LAYER_SHAPES;
+
+            if(trace || bench)
+                flusher = std::thread([this] { flush_loop(); });
+            hipblas_layer_mode.fetch_or(mode);
+        }
+
+        ~hipblasLogger()
+        {
+            hipblas_layer_mode.fetch_and(~uint32_t(HIPBLAS_LAYER_ENV_MASK));
+            if(flusher.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop = true;
+                }
+                wake.notify_one();
+                flusher.join();
+                flush();
+            }
+            if(trace && trace != stderr)
+                std::fclose(trace);
+            if(bench && bench != stderr)
+                std::fclose(bench);
+
+            const char* path = default_shapes_path();
+            if(shapes && !shape_histogram.write(path, default_max_shapes()))
+                std::fprintf(stderr, "hipBLAS: cannot open HIPBLAS_LOG_SHAPES_PATH=%s\n", path);
+        }
+
+        std::shared_ptr<hipblasCallRing> add_ring()
+        {
+            auto                        ring = std::make_shared<hipblasCallRing>();
+            std::lock_guard<std::mutex> lock(mutex);
+            rings.push_back(ring);
+            return ring;
+        }
+    };
+
+    hipblasLogger logger;
+
+    // The calling thread's ring, created on the first logged call from that thread
+    struct hipblasThreadRing
+    {
+        std::shared_ptr<hipblasCallRing> ring;
+
+        ~hipblasThreadRing()
+        {
+            if(ring)
+                ring->orphaned.store(true);
+        }
+    };
+
+    thread_local hipblasThreadRing thread_ring;
+
+    // Calls made from inside another exported function are not logged
+    thread_local int call_depth = 0;
+
+    // Callbacks set by hipblasSetCallbacks. Callbacks that are replaced are kept, as calls
+    // in progress on other threads may still use them.
+    std::atomic<const hipblasCallbacks*>           current_callbacks{nullptr};
+    std::mutex                                     callbacks_mutex;
+    std::vector<std::unique_ptr<hipblasCallbacks>> set_callbacks;
+
+    // Names of the values recorded for the function of record, as passed to callbacks
+    const char* callback_arg_names(const hipblasCallRecord& record)
+    {
+        thread_local std::unordered_map<const char*, std::string> arg_names;
+
+        auto it = arg_names.find(record.function);
+        if(it == arg_names.end())
+        {
+            std::string joined;
+            for(const std::string& name : hipblasGetRecordArgNames(record))
+                joined += (joined.empty() ? "" : ",") + name;
+            it = arg_names.emplace(record.function, std::move(joined)).first;
+        }
+        return it->second.c_str();
+    }
+
+    void invoke_callback(hipblasCallback_t        callback,
+                         const hipblasCallbacks&  callbacks,
+                         const hipblasCallRecord& record,
+                         int64_t                  duration_ns)
+    {
+        hipblasCallInfo info;
+        info.function = record.function;
+        info.handle   = record.handle;
+        info.stream   = nullptr;
+        if(record.handle)
+            hipblasGetStream(record.handle, &info.stream);
+        info.numArgs    = record.num_args;
+        info.argNames   = callback_arg_names(record);
+        info.args       = record.values;
+        info.durationNs = duration_ns;
+        callback(callbacks.user_data, &info);
+    }
+}
+
+void hipblasEnableLayersForNewHandle()
+{
+    // Statistics need no log file, so bit 4 of HIPBLAS_LAYER is also honoured when it is set
+    // after hipBLAS is loaded
+    const char* env = std::getenv("HIPBLAS_LAYER");
+    if(env && (std::strtoul(env, nullptr, 0) & HIPBLAS_LAYER_STATISTICS))
+        hipblas_layer_mode.fetch_or(HIPBLAS_LAYER_STATISTICS);
+}
+
+bool hipblasParseFunctionName(const char* function, hipblasFunctionName& parsed)
+{
+    std::string name = function;
+    if(name.compare(0, 7, "hipblas") != 0)
+        return false;
+    name.erase(0, 7);
+
+    auto strip_suffix = [&name](const char* suffix) {
+        size_t len = std::strlen(suffix);
+        if(name.size() > len && name.compare(name.size() - len, len, suffix) == 0)
+        {
+            name.erase(name.size() - len);
+            return true;
+        }
+        return false;
+    };
+
+    parsed.api_64 = strip_suffix("_64");
+    strip_suffix("_v2");
+    parsed.scalar_arrays = strip_suffix("WithScalarArrays");
+    strip_suffix("WithFlags");
+    parsed.epilogue = strip_suffix("WithEpilogue");
+    parsed.ex       = strip_suffix("Ex");
+    parsed.batch    = strip_suffix("StridedBatched") ? "_strided_batched"
+                      : strip_suffix("Batched")      ? "_batched"
+                      : strip_suffix("Grouped")      ? "_grouped"
+                                                     : "";
+
+    auto is_precision = [](char c) {
+        return c == 'h' || c == 's' || c == 'd' || c == 'c' || c == 'z';
+    };
+    auto lower = [](char c) { return char(std::tolower(c)); };
+
+    // Isamax, Scasum, Csscal, Crot, Sgemm, ...
+    size_t skip = 0;
+    if(!parsed.ex && name.size() > 2)
+    {
+        if(name[0] == 'I' && is_precision(name[1]))
+        {
+            parsed.precision = name[1];
+            skip             = 2;
+        }
+        else if(name == "Scasum" || name == "Scnrm2" || name == "Dzasum" || name == "Dznrm2")
+        {
+            parsed.precision = name[1];
+            skip             = 2;
+        }
+        else if(name == "Csscal" || name == "Zdscal" || name == "Csrot" || name == "Zdrot")
+        {
+            parsed.precision      = lower(name[0]);
+            parsed.real_precision = name[1];
+            parsed.real_c         = name[2] == 'r';
+            skip                  = 2;
+        }
+        else if(name.compare(0, 3, "Set") != 0 && std::islower(name[1])
+                && is_precision(lower(name[0])))
+        {
+            parsed.precision = lower(name[0]);
+            if(name == "Crot" || name == "Zrot" || name == "Crotg" || name == "Zrotg")
+                parsed.real_precision = name[0] == 'C' ? 's' : 'd';
+            skip = 1;
+        }
+    }
+    name.erase(0, skip);
+
+    parsed.base.clear();
+    for(char c : name)
+        parsed.base += lower(c);
+    return true;
+}
+
+std::vector<std::string> hipblasGetRecordArgNames(const hipblasCallRecord& record)
+{
+    std::vector<std::string> names;
+    const char*              p = record.arg_names;
+    while(*p)
+    {
+        while(*p == ' ' || *p == ',')
+            p++;
+        const char* q = p;
+        while(*q && *q != ',' && *q != ' ')
+            q++;
+        std::string name(p, q);
+        const char* canonical = canonical_arg_name(name);
+        names.push_back(canonical ? canonical : name);
+        p = q;
+    }
+    // The handle is not recorded as a value
+    if(names.size() == size_t(record.num_args) + 1)
+        names.erase(names.begin());
+    names.resize(record.num_args);
+    return names;
+}
+
+void hipblasApiCall::begin()
+{
+    if(call_depth)
+        return;
+    call_depth++;
+    active = true;
+
+    if(hipblas_layer_mode.load(std::memory_order_relaxed) & HIPBLAS_LAYER_CALLBACKS)
+    {
+        callbacks = current_callbacks.load(std::memory_order_acquire);
+        if(callbacks && callbacks->pre_call)
+            invoke_callback(callbacks->pre_call, *callbacks, record, 0);
+    }
+    record.start_ns = steady_clock_ns();
+}
+
+void hipblasApiCall::end()
+{
+    record.duration_ns = steady_clock_ns() - record.start_ns;
+    if(callbacks && callbacks->post_call)
+        invoke_callback(callbacks->post_call, *callbacks, record, record.duration_ns);
+    call_depth--;
+
+    uint32_t mode = hipblas_layer_mode.load(std::memory_order_relaxed);
+    if(mode & (HIPBLAS_LAYER_TRACE | HIPBLAS_LAYER_BENCH))
+    {
+        if(!thread_ring.ring)
+            thread_ring.ring = logger.add_ring();
+        thread_ring.ring->push(record);
+    }
+    if((mode & HIPBLAS_LAYER_STATISTICS) && record.handle)
+        hipblasAddCallStatistics(record);
+    if(mode & HIPBLAS_LAYER_SHAPES)
+        shape_histogram.add(record);
+}
+
+extern "C" hipblasStatus_t
+    hipblasSetCallbacks(hipblasCallback_t preCall, hipblasCallback_t postCall, void* userData)
+try
+{
+    std::lock_guard<std::mutex> lock(callbacks_mutex);
+    if(!preCall && !postCall)
+    {
+        hipblas_layer_mode.fetch_and(~uint32_t(HIPBLAS_LAYER_CALLBACKS));
+        current_callbacks.store(nullptr, std::memory_order_release);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    set_callbacks.push_back(
+        std::make_unique<hipblasCallbacks>(hipblasCallbacks{preCall, postCall, userData}));
+    current_callbacks.store(set_callbacks.back().get(), std::memory_order_release);
+    hipblas_layer_mode.fetch_or(HIPBLAS_LAYER_CALLBACKS);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasWriteShapeHistogram(const char* path, int maxShapes)
+try
+{
+    if(maxShapes < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!(hipblas_layer_mode.load() & HIPBLAS_LAYER_SHAPES))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(!path)
+        path = default_shapes_path();
+    return shape_histogram.write(path, maxShapes ? maxShapes : default_max_shapes())
+               ? HIPBLAS_STATUS_SUCCESS
+               : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,1323 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+// The matcopy functions are computed with geam, C = alpha*op( A ) + beta*op( B ), with beta = 0
+// and B = A. In-place transposes and changes of leading dimension write op( A ) to scratch
+// memory, then copy it back with a second geam.
+namespace
+{
+    // Scratch memory for in-place matcopy is allocated for as many matrices as fit in this
+    // size, or for one matrix if it is larger
+    constexpr size_t max_scratch_size = 64 << 20;
+
+    // Bytes 0 to 15 hold zero in every precision, bytes 16 to 23 a float complex one and
+    // bytes 32 to 47 a double complex one, whose real parts are float and double one
+    constexpr size_t scalar_constants_size = 48;
+
+    void fill_scalar_constants(unsigned char* constants)
+    {
+        const float  one_f = 1.0f;
+        const double one_d = 1.0;
+        std::memset(constants, 0, scalar_constants_size);
+        std::memcpy(constants + 16, &one_f, sizeof(one_f));
+        std::memcpy(constants + 32, &one_d, sizeof(one_d));
+    }
+
+    const unsigned char* host_scalar_constants()
+    {
+        alignas(16) static unsigned char constants[scalar_constants_size];
+        static std::once_flag            filled;
+        std::call_once(filled, fill_scalar_constants, constants);
+        return constants;
+    }
+
+    // Copies of the constants in the memory of each device, which are never freed
+    const unsigned char* device_scalar_constants()
+    {
+        static std::mutex                                     mutex;
+        static std::unordered_map<int, const unsigned char*> constants;
+
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto&                       device_constants = constants[device];
+        if(!device_constants)
+        {
+            unsigned char host[scalar_constants_size];
+            fill_scalar_constants(host);
+
+            void* memory = nullptr;
+            if(hipMalloc(&memory, scalar_constants_size) != hipSuccess)
+                return nullptr;
+            if(hipMemcpy(memory, host, scalar_constants_size, hipMemcpyHostToDevice) != hipSuccess)
+            {
+                (void)hipFree(memory);
+                return nullptr;
+            }
+            device_constants = static_cast<const unsigned char*>(memory);
+        }
+        return device_constants;
+    }
+
+    // Zero and one of type T, in host or device memory to match the pointer mode of handle
+    template <typename T>
+    hipblasStatus_t get_scalars(hipblasHandle_t handle, const T*& zero, const T*& one)
+    {
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        const unsigned char* constants = mode == HIPBLAS_POINTER_MODE_DEVICE
+                                             ? device_scalar_constants()
+                                             : host_scalar_constants();
+        if(!constants)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        constexpr bool double_precision = std::is_same<T, double>{} || sizeof(T) == 16;
+        zero = reinterpret_cast<const T*>(constants);
+        one  = reinterpret_cast<const T*>(constants + (double_precision ? 32 : 16));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Dimensions of op( A ) for a rows x cols matrix A
+    void op_dimensions(hipblasOperation_t trans, int rows, int cols, int& m, int& n)
+    {
+        m = trans == HIPBLAS_OP_N ? rows : cols;
+        n = trans == HIPBLAS_OP_N ? cols : rows;
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t omatcopy(F                  geam,
+                             hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             int                rows,
+                             int                cols,
+                             const T*           alpha,
+                             const T*           AP,
+                             int                lda,
+                             T*                 BP,
+                             int                ldb)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+        const T *zero, *one;
+        int      m, n;
+        hipblasStatus_t status = get_scalars(handle, zero, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        op_dimensions(trans, rows, cols, m, n);
+        return geam(handle, trans, trans, m, n, alpha, AP, lda, zero, AP, lda, BP, ldb);
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t omatcopy_batched(F                  geam_batched,
+                                     hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     int                rows,
+                                     int                cols,
+                                     const T*           alpha,
+                                     const T* const     AP[],
+                                     int                lda,
+                                     T* const           BP[],
+                                     int                ldb,
+                                     int                batchCount)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+        const T *zero, *one;
+        int      m, n;
+        hipblasStatus_t status = get_scalars(handle, zero, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        op_dimensions(trans, rows, cols, m, n);
+        return geam_batched(
+            handle, trans, trans, m, n, alpha, AP, lda, zero, AP, lda, BP, ldb, batchCount);
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t omatcopy_strided_batched(F                  geam_strided_batched,
+                                             hipblasHandle_t    handle,
+                                             hipblasOperation_t trans,
+                                             int                rows,
+                                             int                cols,
+                                             const T*           alpha,
+                                             const T*           AP,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             T*                 BP,
+                                             int                ldb,
+                                             hipblasStride      strideB,
+                                             int                batchCount)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+        const T *zero, *one;
+        int      m, n;
+        hipblasStatus_t status = get_scalars(handle, zero, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        op_dimensions(trans, rows, cols, m, n);
+        return geam_strided_batched(handle,
+                                    trans,
+                                    trans,
+                                    m,
+                                    n,
+                                    alpha,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    zero,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    BP,
+                                    ldb,
+                                    strideB,
+                                    batchCount);
+    }
+
+    // Checks the arguments of an in-place matcopy. Returns HIPBLAS_STATUS_SUCCESS with done
+    // set if there is nothing to compute.
+    hipblasStatus_t check_imatcopy(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int                rows,
+                                   int                cols,
+                                   const void*        alpha,
+                                   const void*        ABP,
+                                   int                lda,
+                                   int                ldb,
+                                   int                batchCount,
+                                   bool&              done)
+    {
+        int m, n;
+        op_dimensions(trans, rows, cols, m, n);
+        done = false;
+        if(!handle)
+            return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(rows < 0 || cols < 0 || batchCount < 0 || lda < std::max(1, rows)
+           || ldb < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        done = !rows || !cols || !batchCount;
+        if(!done && (!alpha || !ABP))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Allocates scratch memory for up to batch_count matrices of matrix_size bytes and returns
+    // the number of matrices it holds, or 0 if it cannot be allocated
+    int allocate_matrices(hipblasDeviceScratch& scratch,
+                          hipblasHandle_t       handle,
+                          size_t                matrix_size,
+                          int                   batch_count,
+                          void*&                memory)
+    {
+        int count = int(std::min<size_t>(
+            batch_count, std::max<size_t>(1, max_scratch_size / matrix_size)));
+        memory    = scratch.allocate(handle, count * matrix_size);
+        return memory ? count : 0;
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t imatcopy(F                  geam,
+                             hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             int                rows,
+                             int                cols,
+                             const T*           alpha,
+                             T*                 ABP,
+                             int                lda,
+                             int                ldb)
+    {
+        bool            done;
+        hipblasStatus_t status
+            = check_imatcopy(handle, trans, rows, cols, alpha, ABP, lda, ldb, 1, done);
+        if(status != HIPBLAS_STATUS_SUCCESS || done)
+            return status;
+
+        const T *zero, *one;
+        status = get_scalars(handle, zero, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Scaling without a change of layout is computed in place
+        if(trans == HIPBLAS_OP_N && lda == ldb)
+            return geam(handle,
+                        HIPBLAS_OP_N,
+                        HIPBLAS_OP_N,
+                        rows,
+                        cols,
+                        alpha,
+                        ABP,
+                        lda,
+                        zero,
+                        ABP,
+                        lda,
+                        ABP,
+                        lda);
+
+        int m, n;
+        op_dimensions(trans, rows, cols, m, n);
+        size_t               matrix_size = size_t(m) * n * sizeof(T);
+        hipblasDeviceScratch scratch;
+        T*                   S = static_cast<T*>(scratch.allocate(handle, matrix_size));
+        if(!S)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        status = geam(handle, trans, trans, m, n, alpha, ABP, lda, zero, ABP, lda, S, m);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return geam(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, m, n, one, S, m, zero, S, m, ABP, ldb);
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t imatcopy_strided_batched(F                  geam_strided_batched,
+                                             hipblasHandle_t    handle,
+                                             hipblasOperation_t trans,
+                                             int                rows,
+                                             int                cols,
+                                             const T*           alpha,
+                                             T*                 ABP,
+                                             int                lda,
+                                             int                ldb,
+                                             hipblasStride      stride,
+                                             int                batchCount)
+    {
+        bool            done;
+        hipblasStatus_t status = check_imatcopy(
+            handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount, done);
+        if(status != HIPBLAS_STATUS_SUCCESS || done)
+            return status;
+
+        const T *zero, *one;
+        status = get_scalars(handle, zero, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Scaling without a change of layout is computed in place
+        if(trans == HIPBLAS_OP_N && lda == ldb)
+            return geam_strided_batched(handle,
+                                        HIPBLAS_OP_N,
+                                        HIPBLAS_OP_N,
+                                        rows,
+                                        cols,
+                                        alpha,
+                                        ABP,
+                                        lda,
+                                        stride,
+                                        zero,
+                                        ABP,
+                                        lda,
+                                        stride,
+                                        ABP,
+                                        lda,
+                                        stride,
+                                        batchCount);
+
+        int m, n;
+        op_dimensions(trans, rows, cols, m, n);
+        hipblasStride        matrix_elems = hipblasStride(m) * n;
+        hipblasDeviceScratch scratch;
+        void*                memory;
+
+        int chunk
+            = allocate_matrices(scratch, handle, matrix_elems * sizeof(T), batchCount, memory);
+        if(!chunk)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        T* S = static_cast<T*>(memory);
+
+        for(int first = 0; first < batchCount; first += chunk)
+        {
+            int count    = std::min(chunk, batchCount - first);
+            T*  matrices = ABP + first * stride;
+            status       = geam_strided_batched(handle,
+                                          trans,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          matrices,
+                                          lda,
+                                          stride,
+                                          zero,
+                                          matrices,
+                                          lda,
+                                          stride,
+                                          S,
+                                          m,
+                                          matrix_elems,
+                                          count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = geam_strided_batched(handle,
+                                              HIPBLAS_OP_N,
+                                              HIPBLAS_OP_N,
+                                              m,
+                                              n,
+                                              one,
+                                              S,
+                                              m,
+                                              matrix_elems,
+                                              zero,
+                                              S,
+                                              m,
+                                              matrix_elems,
+                                              matrices,
+                                              ldb,
+                                              stride,
+                                              count);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t imatcopy_batched(F                  geam_batched,
+                                     hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     int                rows,
+                                     int                cols,
+                                     const T*           alpha,
+                                     T* const           ABP[],
+                                     int                lda,
+                                     int                ldb,
+                                     int                batchCount)
+    {
+        bool            done;
+        hipblasStatus_t status = check_imatcopy(
+            handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount, done);
+        if(status != HIPBLAS_STATUS_SUCCESS || done)
+            return status;
+
+        const T *zero, *one;
+        status = get_scalars(handle, zero, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Scaling without a change of layout is computed in place
+        if(trans == HIPBLAS_OP_N && lda == ldb)
+            return geam_batched(handle,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_OP_N,
+                                rows,
+                                cols,
+                                alpha,
+                                ABP,
+                                lda,
+                                zero,
+                                ABP,
+                                lda,
+                                ABP,
+                                lda,
+                                batchCount);
+
+        int m, n;
+        op_dimensions(trans, rows, cols, m, n);
+        size_t               matrix_size = size_t(m) * n * sizeof(T);
+        hipblasDeviceScratch scratch;
+        void*                memory;
+
+        int chunk = allocate_matrices(scratch, handle, matrix_size, batchCount, memory);
+        if(!chunk)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        // The scratch matrices are passed to geam through a pointer array kept by the handle
+        void** S;
+        status = hipblasGetStridedPointerArray(handle, memory, matrix_size, chunk, &S);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        for(int first = 0; first < batchCount; first += chunk)
+        {
+            int count = std::min(chunk, batchCount - first);
+            status    = geam_batched(handle,
+                                  trans,
+                                  trans,
+                                  m,
+                                  n,
+                                  alpha,
+                                  ABP + first,
+                                  lda,
+                                  zero,
+                                  ABP + first,
+                                  lda,
+                                  reinterpret_cast<T* const*>(S),
+                                  m,
+                                  count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = geam_batched(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      m,
+                                      n,
+                                      one,
+                                      reinterpret_cast<const T* const*>(S),
+                                      m,
+                                      zero,
+                                      reinterpret_cast<const T* const*>(S),
+                                      m,
+                                      ABP + first,
+                                      ldb,
+                                      count);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSomatcopy(hipblasHandle_t    handle,
+                                 hipblasOperation_t trans,
+                                 int                rows,
+                                 int                cols,
+                                 const float*       alpha,
+                                 const float*       AP,
+                                 int                lda,
+                                 float*             BP,
+                                 int                ldb)
+try
+{
+    return omatcopy(hipblasSgeam, handle, trans, rows, cols, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDomatcopy(hipblasHandle_t    handle,
+                                 hipblasOperation_t trans,
+                                 int                rows,
+                                 int                cols,
+                                 const double*      alpha,
+                                 const double*      AP,
+                                 int                lda,
+                                 double*            BP,
+                                 int                ldb)
+try
+{
+    return omatcopy(hipblasDgeam, handle, trans, rows, cols, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasComatcopy(hipblasHandle_t       handle,
+                                 hipblasOperation_t    trans,
+                                 int                   rows,
+                                 int                   cols,
+                                 const hipblasComplex* alpha,
+                                 const hipblasComplex* AP,
+                                 int                   lda,
+                                 hipblasComplex*       BP,
+                                 int                   ldb)
+try
+{
+    return omatcopy(hipblasCgeam, handle, trans, rows, cols, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZomatcopy(hipblasHandle_t             handle,
+                                 hipblasOperation_t          trans,
+                                 int                         rows,
+                                 int                         cols,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* AP,
+                                 int                         lda,
+                                 hipblasDoubleComplex*       BP,
+                                 int                         ldb)
+try
+{
+    return omatcopy(hipblasZgeam, handle, trans, rows, cols, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasComatcopy_v2(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                rows,
+                                    int                cols,
+                                    const hipComplex*  alpha,
+                                    const hipComplex*  AP,
+                                    int                lda,
+                                    hipComplex*        BP,
+                                    int                ldb)
+try
+{
+    return omatcopy(hipblasCgeam_v2, handle, trans, rows, cols, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZomatcopy_v2(hipblasHandle_t         handle,
+                                    hipblasOperation_t      trans,
+                                    int                     rows,
+                                    int                     cols,
+                                    const hipDoubleComplex* alpha,
+                                    const hipDoubleComplex* AP,
+                                    int                     lda,
+                                    hipDoubleComplex*       BP,
+                                    int                     ldb)
+try
+{
+    return omatcopy(hipblasZgeam_v2, handle, trans, rows, cols, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSomatcopyBatched(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                rows,
+                                        int                cols,
+                                        const float*       alpha,
+                                        const float* const AP[],
+                                        int                lda,
+                                        float* const       BP[],
+                                        int                ldb,
+                                        int                batchCount)
+try
+{
+    return omatcopy_batched(
+        hipblasSgeamBatched, handle, trans, rows, cols, alpha, AP, lda, BP, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDomatcopyBatched(hipblasHandle_t     handle,
+                                        hipblasOperation_t  trans,
+                                        int                 rows,
+                                        int                 cols,
+                                        const double*       alpha,
+                                        const double* const AP[],
+                                        int                 lda,
+                                        double* const       BP[],
+                                        int                 ldb,
+                                        int                 batchCount)
+try
+{
+    return omatcopy_batched(
+        hipblasDgeamBatched, handle, trans, rows, cols, alpha, AP, lda, BP, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasComatcopyBatched(hipblasHandle_t             handle,
+                                        hipblasOperation_t          trans,
+                                        int                         rows,
+                                        int                         cols,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const AP[],
+                                        int                         lda,
+                                        hipblasComplex* const       BP[],
+                                        int                         ldb,
+                                        int                         batchCount)
+try
+{
+    return omatcopy_batched(
+        hipblasCgeamBatched, handle, trans, rows, cols, alpha, AP, lda, BP, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZomatcopyBatched(hipblasHandle_t                   handle,
+                                        hipblasOperation_t                trans,
+                                        int                               rows,
+                                        int                               cols,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const AP[],
+                                        int                               lda,
+                                        hipblasDoubleComplex* const       BP[],
+                                        int                               ldb,
+                                        int                               batchCount)
+try
+{
+    return omatcopy_batched(
+        hipblasZgeamBatched, handle, trans, rows, cols, alpha, AP, lda, BP, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasComatcopyBatched_v2(hipblasHandle_t         handle,
+                                           hipblasOperation_t      trans,
+                                           int                     rows,
+                                           int                     cols,
+                                           const hipComplex*       alpha,
+                                           const hipComplex* const AP[],
+                                           int                     lda,
+                                           hipComplex* const       BP[],
+                                           int                     ldb,
+                                           int                     batchCount)
+try
+{
+    return omatcopy_batched(
+        hipblasCgeamBatched_v2, handle, trans, rows, cols, alpha, AP, lda, BP, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZomatcopyBatched_v2(hipblasHandle_t               handle,
+                                           hipblasOperation_t            trans,
+                                           int                           rows,
+                                           int                           cols,
+                                           const hipDoubleComplex*       alpha,
+                                           const hipDoubleComplex* const AP[],
+                                           int                           lda,
+                                           hipDoubleComplex* const       BP[],
+                                           int                           ldb,
+                                           int                           batchCount)
+try
+{
+    return omatcopy_batched(
+        hipblasZgeamBatched_v2, handle, trans, rows, cols, alpha, AP, lda, BP, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSomatcopyStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                rows,
+                                               int                cols,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               float*             BP,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               int                batchCount)
+try
+{
+    return omatcopy_strided_batched(hipblasSgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    BP,
+                                    ldb,
+                                    strideB,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDomatcopyStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                rows,
+                                               int                cols,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               double*            BP,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               int                batchCount)
+try
+{
+    return omatcopy_strided_batched(hipblasDgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    BP,
+                                    ldb,
+                                    strideB,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasComatcopyStridedBatched(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int                   rows,
+                                               int                   cols,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int                   lda,
+                                               hipblasStride         strideA,
+                                               hipblasComplex*       BP,
+                                               int                   ldb,
+                                               hipblasStride         strideB,
+                                               int                   batchCount)
+try
+{
+    return omatcopy_strided_batched(hipblasCgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    BP,
+                                    ldb,
+                                    strideB,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZomatcopyStridedBatched(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int                         rows,
+                                               int                         cols,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int                         lda,
+                                               hipblasStride               strideA,
+                                               hipblasDoubleComplex*       BP,
+                                               int                         ldb,
+                                               hipblasStride               strideB,
+                                               int                         batchCount)
+try
+{
+    return omatcopy_strided_batched(hipblasZgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    BP,
+                                    ldb,
+                                    strideB,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasComatcopyStridedBatched_v2(hipblasHandle_t    handle,
+                                                  hipblasOperation_t trans,
+                                                  int                rows,
+                                                  int                cols,
+                                                  const hipComplex*  alpha,
+                                                  const hipComplex*  AP,
+                                                  int                lda,
+                                                  hipblasStride      strideA,
+                                                  hipComplex*        BP,
+                                                  int                ldb,
+                                                  hipblasStride      strideB,
+                                                  int                batchCount)
+try
+{
+    return omatcopy_strided_batched(hipblasCgeamStridedBatched_v2,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    BP,
+                                    ldb,
+                                    strideB,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZomatcopyStridedBatched_v2(hipblasHandle_t         handle,
+                                                  hipblasOperation_t      trans,
+                                                  int                     rows,
+                                                  int                     cols,
+                                                  const hipDoubleComplex* alpha,
+                                                  const hipDoubleComplex* AP,
+                                                  int                     lda,
+                                                  hipblasStride           strideA,
+                                                  hipDoubleComplex*       BP,
+                                                  int                     ldb,
+                                                  hipblasStride           strideB,
+                                                  int                     batchCount)
+try
+{
+    return omatcopy_strided_batched(hipblasZgeamStridedBatched_v2,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    AP,
+                                    lda,
+                                    strideA,
+                                    BP,
+                                    ldb,
+                                    strideB,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSimatcopy(hipblasHandle_t    handle,
+                                 hipblasOperation_t trans,
+                                 int                rows,
+                                 int                cols,
+                                 const float*       alpha,
+                                 float*             ABP,
+                                 int                lda,
+                                 int                ldb)
+try
+{
+    return imatcopy(hipblasSgeam, handle, trans, rows, cols, alpha, ABP, lda, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDimatcopy(hipblasHandle_t    handle,
+                                 hipblasOperation_t trans,
+                                 int                rows,
+                                 int                cols,
+                                 const double*      alpha,
+                                 double*            ABP,
+                                 int                lda,
+                                 int                ldb)
+try
+{
+    return imatcopy(hipblasDgeam, handle, trans, rows, cols, alpha, ABP, lda, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCimatcopy(hipblasHandle_t       handle,
+                                 hipblasOperation_t    trans,
+                                 int                   rows,
+                                 int                   cols,
+                                 const hipblasComplex* alpha,
+                                 hipblasComplex*       ABP,
+                                 int                   lda,
+                                 int                   ldb)
+try
+{
+    return imatcopy(hipblasCgeam, handle, trans, rows, cols, alpha, ABP, lda, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZimatcopy(hipblasHandle_t             handle,
+                                 hipblasOperation_t          trans,
+                                 int                         rows,
+                                 int                         cols,
+                                 const hipblasDoubleComplex* alpha,
+                                 hipblasDoubleComplex*       ABP,
+                                 int                         lda,
+                                 int                         ldb)
+try
+{
+    return imatcopy(hipblasZgeam, handle, trans, rows, cols, alpha, ABP, lda, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCimatcopy_v2(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                rows,
+                                    int                cols,
+                                    const hipComplex*  alpha,
+                                    hipComplex*        ABP,
+                                    int                lda,
+                                    int                ldb)
+try
+{
+    return imatcopy(hipblasCgeam_v2, handle, trans, rows, cols, alpha, ABP, lda, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZimatcopy_v2(hipblasHandle_t         handle,
+                                    hipblasOperation_t      trans,
+                                    int                     rows,
+                                    int                     cols,
+                                    const hipDoubleComplex* alpha,
+                                    hipDoubleComplex*       ABP,
+                                    int                     lda,
+                                    int                     ldb)
+try
+{
+    return imatcopy(hipblasZgeam_v2, handle, trans, rows, cols, alpha, ABP, lda, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSimatcopyBatched(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                rows,
+                                        int                cols,
+                                        const float*       alpha,
+                                        float* const       ABP[],
+                                        int                lda,
+                                        int                ldb,
+                                        int                batchCount)
+try
+{
+    return imatcopy_batched(
+        hipblasSgeamBatched, handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDimatcopyBatched(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                rows,
+                                        int                cols,
+                                        const double*      alpha,
+                                        double* const      ABP[],
+                                        int                lda,
+                                        int                ldb,
+                                        int                batchCount)
+try
+{
+    return imatcopy_batched(
+        hipblasDgeamBatched, handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCimatcopyBatched(hipblasHandle_t       handle,
+                                        hipblasOperation_t    trans,
+                                        int                   rows,
+                                        int                   cols,
+                                        const hipblasComplex* alpha,
+                                        hipblasComplex* const ABP[],
+                                        int                   lda,
+                                        int                   ldb,
+                                        int                   batchCount)
+try
+{
+    return imatcopy_batched(
+        hipblasCgeamBatched, handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZimatcopyBatched(hipblasHandle_t             handle,
+                                        hipblasOperation_t          trans,
+                                        int                         rows,
+                                        int                         cols,
+                                        const hipblasDoubleComplex* alpha,
+                                        hipblasDoubleComplex* const ABP[],
+                                        int                         lda,
+                                        int                         ldb,
+                                        int                         batchCount)
+try
+{
+    return imatcopy_batched(
+        hipblasZgeamBatched, handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCimatcopyBatched_v2(hipblasHandle_t    handle,
+                                           hipblasOperation_t trans,
+                                           int                rows,
+                                           int                cols,
+                                           const hipComplex*  alpha,
+                                           hipComplex* const  ABP[],
+                                           int                lda,
+                                           int                ldb,
+                                           int                batchCount)
+try
+{
+    return imatcopy_batched(
+        hipblasCgeamBatched_v2, handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZimatcopyBatched_v2(hipblasHandle_t         handle,
+                                           hipblasOperation_t      trans,
+                                           int                     rows,
+                                           int                     cols,
+                                           const hipDoubleComplex* alpha,
+                                           hipDoubleComplex* const ABP[],
+                                           int                     lda,
+                                           int                     ldb,
+                                           int                     batchCount)
+try
+{
+    return imatcopy_batched(
+        hipblasZgeamBatched_v2, handle, trans, rows, cols, alpha, ABP, lda, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSimatcopyStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                rows,
+                                               int                cols,
+                                               const float*       alpha,
+                                               float*             ABP,
+                                               int                lda,
+                                               int                ldb,
+                                               hipblasStride      stride,
+                                               int                batchCount)
+try
+{
+    return imatcopy_strided_batched(hipblasSgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    ABP,
+                                    lda,
+                                    ldb,
+                                    stride,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDimatcopyStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                rows,
+                                               int                cols,
+                                               const double*      alpha,
+                                               double*            ABP,
+                                               int                lda,
+                                               int                ldb,
+                                               hipblasStride      stride,
+                                               int                batchCount)
+try
+{
+    return imatcopy_strided_batched(hipblasDgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    ABP,
+                                    lda,
+                                    ldb,
+                                    stride,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCimatcopyStridedBatched(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int                   rows,
+                                               int                   cols,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       ABP,
+                                               int                   lda,
+                                               int                   ldb,
+                                               hipblasStride         stride,
+                                               int                   batchCount)
+try
+{
+    return imatcopy_strided_batched(hipblasCgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    ABP,
+                                    lda,
+                                    ldb,
+                                    stride,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZimatcopyStridedBatched(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int                         rows,
+                                               int                         cols,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       ABP,
+                                               int                         lda,
+                                               int                         ldb,
+                                               hipblasStride               stride,
+                                               int                         batchCount)
+try
+{
+    return imatcopy_strided_batched(hipblasZgeamStridedBatched,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    ABP,
+                                    lda,
+                                    ldb,
+                                    stride,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCimatcopyStridedBatched_v2(hipblasHandle_t    handle,
+                                                  hipblasOperation_t trans,
+                                                  int                rows,
+                                                  int                cols,
+                                                  const hipComplex*  alpha,
+                                                  hipComplex*        ABP,
+                                                  int                lda,
+                                                  int                ldb,
+                                                  hipblasStride      stride,
+                                                  int                batchCount)
+try
+{
+    return imatcopy_strided_batched(hipblasCgeamStridedBatched_v2,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    ABP,
+                                    lda,
+                                    ldb,
+                                    stride,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZimatcopyStridedBatched_v2(hipblasHandle_t         handle,
+                                                  hipblasOperation_t      trans,
+                                                  int                     rows,
+                                                  int                     cols,
+                                                  const hipDoubleComplex* alpha,
+                                                  hipDoubleComplex*       ABP,
+                                                  int                     lda,
+                                                  int                     ldb,
+                                                  hipblasStride           stride,
+                                                  int                     batchCount)
+try
+{
+    return imatcopy_strided_batched(hipblasZgeamStridedBatched_v2,
+                                    handle,
+                                    trans,
+                                    rows,
+                                    cols,
+                                    alpha,
+                                    ABP,
+                                    lda,
+                                    ldb,
+                                    stride,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
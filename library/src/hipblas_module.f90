@@ -13839,4 +13839,1113 @@ module hipblas
         end function hipblasZgelsStridedBatched
     end interface
 
+    ! potrf
+    interface
+        function hipblasSpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasSpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasSpotrf
+    end interface
+
+    interface
+        function hipblasDpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasDpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasDpotrf
+    end interface
+
+    interface
+        function hipblasCpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasCpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasCpotrf
+    end interface
+
+    interface
+        function hipblasZpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasZpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasZpotrf
+    end interface
+
+    ! potrf_batched
+    interface
+        function hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batch_count) &
+            bind(c, name='hipblasSpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSpotrfBatched
+    end interface
+
+    interface
+        function hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batch_count) &
+            bind(c, name='hipblasDpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDpotrfBatched
+    end interface
+
+    interface
+        function hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batch_count) &
+            bind(c, name='hipblasCpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCpotrfBatched
+    end interface
+
+    interface
+        function hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batch_count) &
+            bind(c, name='hipblasZpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZpotrfBatched
+    end interface
+
+    ! potrf_strided_batched
+    interface
+        function hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count) &
+            bind(c, name='hipblasSpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count) &
+            bind(c, name='hipblasDpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count) &
+            bind(c, name='hipblasCpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count) &
+            bind(c, name='hipblasZpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZpotrfStridedBatched
+    end interface
+
+    ! potrs
+    interface
+        function hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasSpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasSpotrs
+    end interface
+
+    interface
+        function hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasDpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasDpotrs
+    end interface
+
+    interface
+        function hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasCpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasCpotrs
+    end interface
+
+    interface
+        function hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasZpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasZpotrs
+    end interface
+
+    ! potrs_batched
+    interface
+        function hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+            bind(c, name='hipblasSpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSpotrsBatched
+    end interface
+
+    interface
+        function hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+            bind(c, name='hipblasDpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDpotrsBatched
+    end interface
+
+    interface
+        function hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+            bind(c, name='hipblasCpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCpotrsBatched
+    end interface
+
+    interface
+        function hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count) &
+            bind(c, name='hipblasZpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZpotrsBatched
+    end interface
+
+    ! potrs_strided_batched
+    interface
+        function hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                             strideB, info, batch_count) &
+            bind(c, name='hipblasSpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                             strideB, info, batch_count) &
+            bind(c, name='hipblasDpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                             strideB, info, batch_count) &
+            bind(c, name='hipblasCpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                             strideB, info, batch_count) &
+            bind(c, name='hipblasZpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZpotrsStridedBatched
+    end interface
+
+    ! gesv_batched
+    interface
+        function hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                     batch_count) &
+            bind(c, name='hipblasSgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasSgesvBatched
+    end interface
+
+    interface
+        function hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                     batch_count) &
+            bind(c, name='hipblasDgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasDgesvBatched
+    end interface
+
+    interface
+        function hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                     batch_count) &
+            bind(c, name='hipblasCgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasCgesvBatched
+    end interface
+
+    interface
+        function hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, deviceInfo, &
+                                     batch_count) &
+            bind(c, name='hipblasZgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasZgesvBatched
+    end interface
+
+    ! gesv_strided_batched
+    interface
+        function hipblasSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                            ldb, strideB, info, deviceInfo, batch_count) &
+            bind(c, name='hipblasSgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasSgesvStridedBatched
+    end interface
+
+    interface
+        function hipblasDgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                            ldb, strideB, info, deviceInfo, batch_count) &
+            bind(c, name='hipblasDgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasDgesvStridedBatched
+    end interface
+
+    interface
+        function hipblasCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                            ldb, strideB, info, deviceInfo, batch_count) &
+            bind(c, name='hipblasCgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasCgesvStridedBatched
+    end interface
+
+    interface
+        function hipblasZgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+                                            ldb, strideB, info, deviceInfo, batch_count) &
+            bind(c, name='hipblasZgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batch_count
+        end function hipblasZgesvStridedBatched
+    end interface
+
+    ! getri
+    interface
+        function hipblasSgetri(handle, n, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasSgetri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetri
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasSgetri
+    end interface
+
+    interface
+        function hipblasDgetri(handle, n, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasDgetri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetri
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasDgetri
+    end interface
+
+    interface
+        function hipblasCgetri(handle, n, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasCgetri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetri
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasCgetri
+    end interface
+
+    interface
+        function hipblasZgetri(handle, n, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasZgetri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetri
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasZgetri
+    end interface
+
+    ! getri_strided_batched
+    interface
+        function hipblasSgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                             strideC, info, batch_count) &
+            bind(c, name='hipblasSgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSgetriStridedBatched
+    end interface
+
+    interface
+        function hipblasDgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                             strideC, info, batch_count) &
+            bind(c, name='hipblasDgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDgetriStridedBatched
+    end interface
+
+    interface
+        function hipblasCgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                             strideC, info, batch_count) &
+            bind(c, name='hipblasCgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCgetriStridedBatched
+    end interface
+
+    interface
+        function hipblasZgetriStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                                             strideC, info, batch_count) &
+            bind(c, name='hipblasZgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZgetriStridedBatched
+    end interface
+
+    ! ormqr
+    interface
+        function hipblasSormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasSormqr')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSormqr
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasSormqr
+    end interface
+
+    interface
+        function hipblasDormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasDormqr')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDormqr
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasDormqr
+    end interface
+
+    interface
+        function hipblasCunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasCunmqr')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCunmqr
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasCunmqr
+    end interface
+
+    interface
+        function hipblasZunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info) &
+            bind(c, name='hipblasZunmqr')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZunmqr
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasZunmqr
+    end interface
+
+    ! ormqr_batched
+    interface
+        function hipblasSormqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                      batch_count) &
+            bind(c, name='hipblasSormqrBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSormqrBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSormqrBatched
+    end interface
+
+    interface
+        function hipblasDormqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                      batch_count) &
+            bind(c, name='hipblasDormqrBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDormqrBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDormqrBatched
+    end interface
+
+    interface
+        function hipblasCunmqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                      batch_count) &
+            bind(c, name='hipblasCunmqrBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCunmqrBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCunmqrBatched
+    end interface
+
+    interface
+        function hipblasZunmqrBatched(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, info, &
+                                      batch_count) &
+            bind(c, name='hipblasZunmqrBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZunmqrBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZunmqrBatched
+    end interface
+
+    ! ormqr_strided_batched
+    interface
+        function hipblasSormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                             strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasSormqrStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSormqrStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSormqrStridedBatched
+    end interface
+
+    interface
+        function hipblasDormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                             strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasDormqrStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDormqrStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDormqrStridedBatched
+    end interface
+
+    interface
+        function hipblasCunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                             strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasCunmqrStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCunmqrStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCunmqrStridedBatched
+    end interface
+
+    interface
+        function hipblasZunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, ipiv, &
+                                             strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasZunmqrStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZunmqrStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZunmqrStridedBatched
+    end interface
+
 end module hipblas
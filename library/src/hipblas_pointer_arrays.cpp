@@ -0,0 +1,268 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include "pointer_arrays.hpp"
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    // Arrays kept per handle before the least recently requested is freed
+    constexpr size_t max_pointer_arrays = 64;
+
+    struct hipblasPointerArrayKey
+    {
+        const char* base;
+        int64_t     stride;
+        int         count;
+
+        bool operator==(const hipblasPointerArrayKey& rhs) const
+        {
+            return base == rhs.base && stride == rhs.stride && count == rhs.count;
+        }
+    };
+
+    struct hipblasPointerArrayKeyHash
+    {
+        size_t operator()(const hipblasPointerArrayKey& key) const
+        {
+            uint64_t hash = uint64_t(uintptr_t(key.base));
+            hash          = (hash ^ uint64_t(key.stride)) * 0x100000001b3ull;
+            hash          = (hash ^ uint64_t(key.count)) * 0x100000001b3ull;
+            return size_t(hash);
+        }
+    };
+
+    struct hipblasPointerArray
+    {
+        hipblasPointerArrayKey key;
+        void**                 device_pointers;
+        hipStream_t            stream; // last stream the array was returned for
+        hipblasDeviceAllocator allocator; // that allocated device_pointers
+    };
+
+    // Number of arrays kept by all handles, so that batched calls only look up their
+    // arrays when there are any
+    std::atomic<size_t> kept_arrays{0};
+
+    // Arrays kept by one handle, most recently requested first
+    struct hipblasPointerArrays
+    {
+        std::mutex                     mutex;
+        std::list<hipblasPointerArray> arrays;
+        std::unordered_map<hipblasPointerArrayKey,
+                           std::list<hipblasPointerArray>::iterator,
+                           hipblasPointerArrayKeyHash>
+            index;
+        std::unordered_map<const void*, std::list<hipblasPointerArray>::iterator> by_address;
+
+        void push_front(const hipblasPointerArray& array)
+        {
+            arrays.push_front(array);
+            index.emplace(array.key, arrays.begin());
+            by_address.emplace(array.device_pointers, arrays.begin());
+            kept_arrays++;
+        }
+
+        void pop_back()
+        {
+            hipblasPointerArray& oldest = arrays.back();
+            oldest.allocator.free(oldest.device_pointers, oldest.stream);
+            index.erase(oldest.key);
+            by_address.erase(oldest.device_pointers);
+            arrays.pop_back();
+            kept_arrays--;
+        }
+
+        ~hipblasPointerArrays()
+        {
+            while(!arrays.empty())
+                pop_back();
+        }
+    };
+
+    std::mutex handle_arrays_mutex;
+    std::unordered_map<hipblasHandle_t, std::shared_ptr<hipblasPointerArrays>> handle_arrays;
+
+    std::shared_ptr<hipblasPointerArrays> get_pointer_arrays(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(handle_arrays_mutex);
+        auto&                       arrays = handle_arrays[handle];
+        if(!arrays)
+            arrays = std::make_shared<hipblasPointerArrays>();
+        return arrays;
+    }
+
+    // Finds the base pointer and stride in elements of elem_size bytes of array, if it was
+    // returned for at least batch_count pointers. state->mutex must be held.
+    bool find_strided_array(hipblasPointerArrays& state,
+                            const void*           array,
+                            int                   batch_count,
+                            size_t                elem_size,
+                            const void*&          base,
+                            hipblasStride&        stride)
+    {
+        auto found = state.by_address.find(array);
+        if(found == state.by_address.end() || !elem_size)
+            return false;
+
+        const hipblasPointerArrayKey& key = found->second->key;
+        if(key.count < batch_count || key.stride < 0 || key.stride % int64_t(elem_size))
+            return false;
+        base   = key.base;
+        stride = key.stride / int64_t(elem_size);
+        return true;
+    }
+}
+
+bool hipblasFindStridedGemmBatch(hipblasHandle_t          handle,
+                                 int                      batch_count,
+                                 const void*              A,
+                                 size_t                   a_size,
+                                 const void*              B,
+                                 size_t                   b_size,
+                                 const void*              C,
+                                 size_t                   c_size,
+                                 hipblasStridedGemmBatch& batch)
+{
+    if(!kept_arrays.load(std::memory_order_relaxed) || batch_count <= 0)
+        return false;
+
+    std::shared_ptr<hipblasPointerArrays> state;
+    {
+        std::lock_guard<std::mutex> lock(handle_arrays_mutex);
+        auto                        found = handle_arrays.find(handle);
+        if(found == handle_arrays.end())
+            return false;
+        state = found->second;
+    }
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    const void*                 c_base;
+    if(!find_strided_array(*state, A, batch_count, a_size, batch.A, batch.strideA)
+       || !find_strided_array(*state, B, batch_count, b_size, batch.B, batch.strideB)
+       || !find_strided_array(*state, C, batch_count, c_size, c_base, batch.strideC))
+        return false;
+    batch.C = const_cast<void*>(c_base);
+    return true;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGetStridedPointerArray(hipblasHandle_t handle,
+                                              const void*     base,
+                                              int64_t         strideBytes,
+                                              int             batchCount,
+                                              void***         pointerArray)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    if(!pointerArray || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+    {
+        *pointerArray = nullptr;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto                        state = get_pointer_arrays(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    hipblasPointerArrayKey key{static_cast<const char*>(base), strideBytes, batchCount};
+    auto                   found = state->index.find(key);
+    if(found != state->index.end())
+    {
+        // The copy filling the array may still be queued on the stream it was made on
+        hipblasPointerArray& array = *found->second;
+        if(array.stream != stream)
+        {
+            if(hipStreamSynchronize(array.stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            array.stream = stream;
+        }
+        state->arrays.splice(state->arrays.begin(), state->arrays, found->second);
+        *pointerArray = array.device_pointers;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    if(state->arrays.size() >= max_pointer_arrays)
+        state->pop_back();
+
+    std::vector<const void*> host_pointers(batchCount);
+    for(int i = 0; i < batchCount; i++)
+        host_pointers[i] = key.base + i * strideBytes;
+
+    size_t                 size = batchCount * sizeof(void*);
+    hipblasDeviceAllocator allocator
+        = hipblasGetHandleState(handle)->get_user_workspace().allocator;
+    void* device_pointers = allocator.allocate(size, stream);
+    if(!device_pointers)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    // host_pointers is pageable, so it may be freed once the copy is enqueued
+    if(hipMemcpyAsync(device_pointers, host_pointers.data(), size, hipMemcpyHostToDevice, stream)
+       != hipSuccess)
+    {
+        allocator.free(device_pointers, stream);
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    state->push_front({key, static_cast<void**>(device_pointers), stream, allocator});
+    *pointerArray = static_cast<void**>(device_pointers);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasClearPointerArrays(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    // Freed by the destructor once no other thread is using the arrays
+    std::lock_guard<std::mutex> lock(handle_arrays_mutex);
+    handle_arrays.erase(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
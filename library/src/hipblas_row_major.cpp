@@ -0,0 +1,757 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+
+// The row-major functions compute on the column-major transposes of their matrices. The
+// transpose of a row-major matrix is the same memory read as column-major, so only the
+// arguments change: operands and dimensions are exchanged, lower becomes upper and left
+// becomes right. The column-major call records itself for the logging layers.
+namespace
+{
+    hipblasFillMode_t swap_fill(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER   ? HIPBLAS_FILL_MODE_LOWER
+               : uplo == HIPBLAS_FILL_MODE_LOWER ? HIPBLAS_FILL_MODE_UPPER
+                                                 : uplo;
+    }
+
+    hipblasSideMode_t swap_side(hipblasSideMode_t side)
+    {
+        return side == HIPBLAS_SIDE_LEFT    ? HIPBLAS_SIDE_RIGHT
+               : side == HIPBLAS_SIDE_RIGHT ? HIPBLAS_SIDE_LEFT
+                                            : side;
+    }
+
+    // op( A )^T as an operation on A^T, for operations that transpose a single operand.
+    // HIPBLAS_OP_C is HIPBLAS_OP_T for real types and has no such form for complex types,
+    // so it is passed on unchanged for the column-major function to reject.
+    hipblasOperation_t row_major_op(hipblasOperation_t op, bool is_complex)
+    {
+        switch(op)
+        {
+        case HIPBLAS_OP_N:
+            return HIPBLAS_OP_T;
+        case HIPBLAS_OP_T:
+            return HIPBLAS_OP_N;
+        case HIPBLAS_OP_C:
+            return is_complex ? HIPBLAS_OP_C : HIPBLAS_OP_N;
+        }
+        return op;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasHgemmRowMajor(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const hipblasHalf* alpha,
+                                     const hipblasHalf* AP,
+                                     int                lda,
+                                     const hipblasHalf* BP,
+                                     int                ldb,
+                                     const hipblasHalf* beta,
+                                     hipblasHalf*       CP,
+                                     int                ldc)
+try
+{
+    return hipblasHgemm(handle, transB, transA, n, m, k, alpha, BP, ldb, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmRowMajor(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const float*       alpha,
+                                     const float*       AP,
+                                     int                lda,
+                                     const float*       BP,
+                                     int                ldb,
+                                     const float*       beta,
+                                     float*             CP,
+                                     int                ldc)
+try
+{
+    return hipblasSgemm(handle, transB, transA, n, m, k, alpha, BP, ldb, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmRowMajor(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const double*      alpha,
+                                     const double*      AP,
+                                     int                lda,
+                                     const double*      BP,
+                                     int                ldb,
+                                     const double*      beta,
+                                     double*            CP,
+                                     int                ldc)
+try
+{
+    return hipblasDgemm(handle, transB, transA, n, m, k, alpha, BP, ldb, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmRowMajor(hipblasHandle_t       handle,
+                                     hipblasOperation_t    transA,
+                                     hipblasOperation_t    transB,
+                                     int                   m,
+                                     int                   n,
+                                     int                   k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* AP,
+                                     int                   lda,
+                                     const hipblasComplex* BP,
+                                     int                   ldb,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       CP,
+                                     int                   ldc)
+try
+{
+    return hipblasCgemm(handle, transB, transA, n, m, k, alpha, BP, ldb, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmRowMajor(hipblasHandle_t             handle,
+                                     hipblasOperation_t          transA,
+                                     hipblasOperation_t          transB,
+                                     int                         m,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* AP,
+                                     int                         lda,
+                                     const hipblasDoubleComplex* BP,
+                                     int                         ldb,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       CP,
+                                     int                         ldc)
+try
+{
+    return hipblasZgemm(handle, transB, transA, n, m, k, alpha, BP, ldb, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmRowMajor_v2(hipblasHandle_t    handle,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const hipComplex*  alpha,
+                                        const hipComplex*  AP,
+                                        int                lda,
+                                        const hipComplex*  BP,
+                                        int                ldb,
+                                        const hipComplex*  beta,
+                                        hipComplex*        CP,
+                                        int                ldc)
+try
+{
+    return hipblasCgemm_v2(handle, transB, transA, n, m, k, alpha, BP, ldb, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmRowMajor_v2(hipblasHandle_t         handle,
+                                        hipblasOperation_t      transA,
+                                        hipblasOperation_t      transB,
+                                        int                     m,
+                                        int                     n,
+                                        int                     k,
+                                        const hipDoubleComplex* alpha,
+                                        const hipDoubleComplex* AP,
+                                        int                     lda,
+                                        const hipDoubleComplex* BP,
+                                        int                     ldb,
+                                        const hipDoubleComplex* beta,
+                                        hipDoubleComplex*       CP,
+                                        int                     ldc)
+try
+{
+    return hipblasZgemm_v2(handle, transB, transA, n, m, k, alpha, BP, ldb, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvRowMajor(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     int                m,
+                                     int                n,
+                                     const float*       alpha,
+                                     const float*       AP,
+                                     int                lda,
+                                     const float*       x,
+                                     int                incx,
+                                     const float*       beta,
+                                     float*             y,
+                                     int                incy)
+try
+{
+    return hipblasSgemv(
+        handle, row_major_op(trans, false), n, m, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvRowMajor(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     int                m,
+                                     int                n,
+                                     const double*      alpha,
+                                     const double*      AP,
+                                     int                lda,
+                                     const double*      x,
+                                     int                incx,
+                                     const double*      beta,
+                                     double*            y,
+                                     int                incy)
+try
+{
+    return hipblasDgemv(
+        handle, row_major_op(trans, false), n, m, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvRowMajor(hipblasHandle_t       handle,
+                                     hipblasOperation_t    trans,
+                                     int                   m,
+                                     int                   n,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* AP,
+                                     int                   lda,
+                                     const hipblasComplex* x,
+                                     int                   incx,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       y,
+                                     int                   incy)
+try
+{
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCgemv(
+        handle, row_major_op(trans, true), n, m, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvRowMajor(hipblasHandle_t             handle,
+                                     hipblasOperation_t          trans,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* AP,
+                                     int                         lda,
+                                     const hipblasDoubleComplex* x,
+                                     int                         incx,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       y,
+                                     int                         incy)
+try
+{
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZgemv(
+        handle, row_major_op(trans, true), n, m, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvRowMajor_v2(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const hipComplex*  alpha,
+                                        const hipComplex*  AP,
+                                        int                lda,
+                                        const hipComplex*  x,
+                                        int                incx,
+                                        const hipComplex*  beta,
+                                        hipComplex*        y,
+                                        int                incy)
+try
+{
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasCgemv_v2(
+        handle, row_major_op(trans, true), n, m, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvRowMajor_v2(hipblasHandle_t         handle,
+                                        hipblasOperation_t      trans,
+                                        int                     m,
+                                        int                     n,
+                                        const hipDoubleComplex* alpha,
+                                        const hipDoubleComplex* AP,
+                                        int                     lda,
+                                        const hipDoubleComplex* x,
+                                        int                     incx,
+                                        const hipDoubleComplex* beta,
+                                        hipDoubleComplex*       y,
+                                        int                     incy)
+try
+{
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasZgemv_v2(
+        handle, row_major_op(trans, true), n, m, alpha, AP, lda, x, incx, beta, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmRowMajor(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const float*       alpha,
+                                     const float*       AP,
+                                     int                lda,
+                                     float*             BP,
+                                     int                ldb)
+try
+{
+    return hipblasStrsm(
+        handle, swap_side(side), swap_fill(uplo), transA, diag, n, m, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmRowMajor(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const double*      alpha,
+                                     const double*      AP,
+                                     int                lda,
+                                     double*            BP,
+                                     int                ldb)
+try
+{
+    return hipblasDtrsm(
+        handle, swap_side(side), swap_fill(uplo), transA, diag, n, m, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmRowMajor(hipblasHandle_t       handle,
+                                     hipblasSideMode_t     side,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     hipblasDiagType_t     diag,
+                                     int                   m,
+                                     int                   n,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* AP,
+                                     int                   lda,
+                                     hipblasComplex*       BP,
+                                     int                   ldb)
+try
+{
+    return hipblasCtrsm(
+        handle, swap_side(side), swap_fill(uplo), transA, diag, n, m, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmRowMajor(hipblasHandle_t             handle,
+                                     hipblasSideMode_t           side,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     hipblasDiagType_t           diag,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* AP,
+                                     int                         lda,
+                                     hipblasDoubleComplex*       BP,
+                                     int                         ldb)
+try
+{
+    return hipblasZtrsm(
+        handle, swap_side(side), swap_fill(uplo), transA, diag, n, m, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmRowMajor_v2(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const hipComplex*  alpha,
+                                        const hipComplex*  AP,
+                                        int                lda,
+                                        hipComplex*        BP,
+                                        int                ldb)
+try
+{
+    return hipblasCtrsm_v2(
+        handle, swap_side(side), swap_fill(uplo), transA, diag, n, m, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmRowMajor_v2(hipblasHandle_t         handle,
+                                        hipblasSideMode_t       side,
+                                        hipblasFillMode_t       uplo,
+                                        hipblasOperation_t      transA,
+                                        hipblasDiagType_t       diag,
+                                        int                     m,
+                                        int                     n,
+                                        const hipDoubleComplex* alpha,
+                                        const hipDoubleComplex* AP,
+                                        int                     lda,
+                                        hipDoubleComplex*       BP,
+                                        int                     ldb)
+try
+{
+    return hipblasZtrsm_v2(
+        handle, swap_side(side), swap_fill(uplo), transA, diag, n, m, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkRowMajor(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     int                n,
+                                     int                k,
+                                     const float*       alpha,
+                                     const float*       AP,
+                                     int                lda,
+                                     const float*       beta,
+                                     float*             CP,
+                                     int                ldc)
+try
+{
+    return hipblasSsyrk(
+        handle, swap_fill(uplo), row_major_op(transA, false), n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkRowMajor(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     int                n,
+                                     int                k,
+                                     const double*      alpha,
+                                     const double*      AP,
+                                     int                lda,
+                                     const double*      beta,
+                                     double*            CP,
+                                     int                ldc)
+try
+{
+    return hipblasDsyrk(
+        handle, swap_fill(uplo), row_major_op(transA, false), n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkRowMajor(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int                   n,
+                                     int                   k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* AP,
+                                     int                   lda,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       CP,
+                                     int                   ldc)
+try
+{
+    return hipblasCsyrk(
+        handle, swap_fill(uplo), row_major_op(transA, true), n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkRowMajor(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* AP,
+                                     int                         lda,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       CP,
+                                     int                         ldc)
+try
+{
+    return hipblasZsyrk(
+        handle, swap_fill(uplo), row_major_op(transA, true), n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkRowMajor_v2(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        int                n,
+                                        int                k,
+                                        const hipComplex*  alpha,
+                                        const hipComplex*  AP,
+                                        int                lda,
+                                        const hipComplex*  beta,
+                                        hipComplex*        CP,
+                                        int                ldc)
+try
+{
+    return hipblasCsyrk_v2(
+        handle, swap_fill(uplo), row_major_op(transA, true), n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkRowMajor_v2(hipblasHandle_t         handle,
+                                        hipblasFillMode_t       uplo,
+                                        hipblasOperation_t      transA,
+                                        int                     n,
+                                        int                     k,
+                                        const hipDoubleComplex* alpha,
+                                        const hipDoubleComplex* AP,
+                                        int                     lda,
+                                        const hipDoubleComplex* beta,
+                                        hipDoubleComplex*       CP,
+                                        int                     ldc)
+try
+{
+    return hipblasZsyrk_v2(
+        handle, swap_fill(uplo), row_major_op(transA, true), n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgeamRowMajor(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     const float*       alpha,
+                                     const float*       AP,
+                                     int                lda,
+                                     const float*       beta,
+                                     const float*       BP,
+                                     int                ldb,
+                                     float*             CP,
+                                     int                ldc)
+try
+{
+    return hipblasSgeam(handle, transA, transB, n, m, alpha, AP, lda, beta, BP, ldb, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgeamRowMajor(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     const double*      alpha,
+                                     const double*      AP,
+                                     int                lda,
+                                     const double*      beta,
+                                     const double*      BP,
+                                     int                ldb,
+                                     double*            CP,
+                                     int                ldc)
+try
+{
+    return hipblasDgeam(handle, transA, transB, n, m, alpha, AP, lda, beta, BP, ldb, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeamRowMajor(hipblasHandle_t       handle,
+                                     hipblasOperation_t    transA,
+                                     hipblasOperation_t    transB,
+                                     int                   m,
+                                     int                   n,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* AP,
+                                     int                   lda,
+                                     const hipblasComplex* beta,
+                                     const hipblasComplex* BP,
+                                     int                   ldb,
+                                     hipblasComplex*       CP,
+                                     int                   ldc)
+try
+{
+    return hipblasCgeam(handle, transA, transB, n, m, alpha, AP, lda, beta, BP, ldb, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeamRowMajor(hipblasHandle_t             handle,
+                                     hipblasOperation_t          transA,
+                                     hipblasOperation_t          transB,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* AP,
+                                     int                         lda,
+                                     const hipblasDoubleComplex* beta,
+                                     const hipblasDoubleComplex* BP,
+                                     int                         ldb,
+                                     hipblasDoubleComplex*       CP,
+                                     int                         ldc)
+try
+{
+    return hipblasZgeam(handle, transA, transB, n, m, alpha, AP, lda, beta, BP, ldb, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeamRowMajor_v2(hipblasHandle_t    handle,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        const hipComplex*  alpha,
+                                        const hipComplex*  AP,
+                                        int                lda,
+                                        const hipComplex*  beta,
+                                        const hipComplex*  BP,
+                                        int                ldb,
+                                        hipComplex*        CP,
+                                        int                ldc)
+try
+{
+    return hipblasCgeam_v2(handle, transA, transB, n, m, alpha, AP, lda, beta, BP, ldb, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeamRowMajor_v2(hipblasHandle_t         handle,
+                                        hipblasOperation_t      transA,
+                                        hipblasOperation_t      transB,
+                                        int                     m,
+                                        int                     n,
+                                        const hipDoubleComplex* alpha,
+                                        const hipDoubleComplex* AP,
+                                        int                     lda,
+                                        const hipDoubleComplex* beta,
+                                        const hipDoubleComplex* BP,
+                                        int                     ldb,
+                                        hipDoubleComplex*       CP,
+                                        int                     ldc)
+try
+{
+    return hipblasZgeam_v2(handle, transA, transB, n, m, alpha, AP, lda, beta, BP, ldb, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
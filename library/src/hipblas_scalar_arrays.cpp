@@ -0,0 +1,651 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gemm_ex.hpp"
+#include "logging.hpp"
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+namespace
+{
+    // Calls gemm(first, count, alpha, beta) for runs of consecutive batches with equal alpha
+    // and beta, which can be computed by one call. In device pointer mode the scalars are
+    // copied to the host once to find the runs, and gemm is still passed device pointers.
+    template <typename F>
+    hipblasStatus_t gemm_scalar_runs(hipblasHandle_t handle,
+                                     const void*     alpha,
+                                     const void*     beta,
+                                     size_t          scalar_size,
+                                     int             batch_count,
+                                     F               gemm)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!scalar_size)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        auto              alphas = static_cast<const char*>(alpha);
+        auto              betas  = static_cast<const char*>(beta);
+        const char*       host_alphas = alphas;
+        const char*       host_betas  = betas;
+        std::vector<char> host_scalars;
+        if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            hipStream_t stream;
+            status = hipblasGetStream(handle, &stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            size_t size = batch_count * scalar_size;
+            host_scalars.resize(2 * size);
+            if(hipMemcpyAsync(host_scalars.data(), alpha, size, hipMemcpyDeviceToHost, stream)
+                   != hipSuccess
+               || hipMemcpyAsync(
+                      host_scalars.data() + size, beta, size, hipMemcpyDeviceToHost, stream)
+                      != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            host_alphas = host_scalars.data();
+            host_betas  = host_scalars.data() + size;
+        }
+
+        auto same = [&](int i, int j) {
+            return !std::memcmp(
+                       host_alphas + i * scalar_size, host_alphas + j * scalar_size, scalar_size)
+                   && !std::memcmp(
+                       host_betas + i * scalar_size, host_betas + j * scalar_size, scalar_size);
+        };
+
+        int first = 0;
+        for(int i = 1; i <= batch_count; i++)
+        {
+            if(i < batch_count && same(first, i))
+                continue;
+
+            status = gemm(
+                first, i - first, alphas + first * scalar_size, betas + first * scalar_size);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            first = i;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t gemm_strided_batched_scalar_arrays(F                  gemm_strided_batched,
+                                                       hipblasHandle_t    handle,
+                                                       hipblasOperation_t transA,
+                                                       hipblasOperation_t transB,
+                                                       int                m,
+                                                       int                n,
+                                                       int                k,
+                                                       const T*           alpha,
+                                                       const T*           AP,
+                                                       int                lda,
+                                                       long long          strideA,
+                                                       const T*           BP,
+                                                       int                ldb,
+                                                       long long          strideB,
+                                                       const T*           beta,
+                                                       T*                 CP,
+                                                       int                ldc,
+                                                       long long          strideC,
+                                                       int                batchCount)
+    {
+        return gemm_scalar_runs(
+            handle,
+            alpha,
+            beta,
+            sizeof(T),
+            batchCount,
+            [&](int first, int count, const void* alpha_first, const void* beta_first) {
+                return gemm_strided_batched(handle,
+                                            transA,
+                                            transB,
+                                            m,
+                                            n,
+                                            k,
+                                            static_cast<const T*>(alpha_first),
+                                            AP + first * strideA,
+                                            lda,
+                                            strideA,
+                                            BP + first * strideB,
+                                            ldb,
+                                            strideB,
+                                            static_cast<const T*>(beta_first),
+                                            CP + first * strideC,
+                                            ldc,
+                                            strideC,
+                                            count);
+            });
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasHgemmStridedBatchedWithScalarArrays(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const hipblasHalf* alpha,
+                                                           const hipblasHalf* AP,
+                                                           int                lda,
+                                                           long long          strideA,
+                                                           const hipblasHalf* BP,
+                                                           int                ldb,
+                                                           long long          strideB,
+                                                           const hipblasHalf* beta,
+                                                           hipblasHalf*       CP,
+                                                           int                ldc,
+                                                           long long          strideC,
+                                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+    return gemm_strided_batched_scalar_arrays(hipblasHgemmStridedBatched,
+                                              handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              AP,
+                                              lda,
+                                              strideA,
+                                              BP,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              CP,
+                                              ldc,
+                                              strideC,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatchedWithScalarArrays(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const float*       alpha,
+                                                           const float*       AP,
+                                                           int                lda,
+                                                           long long          strideA,
+                                                           const float*       BP,
+                                                           int                ldb,
+                                                           long long          strideB,
+                                                           const float*       beta,
+                                                           float*             CP,
+                                                           int                ldc,
+                                                           long long          strideC,
+                                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+    return gemm_strided_batched_scalar_arrays(hipblasSgemmStridedBatched,
+                                              handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              AP,
+                                              lda,
+                                              strideA,
+                                              BP,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              CP,
+                                              ldc,
+                                              strideC,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatchedWithScalarArrays(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const double*      alpha,
+                                                           const double*      AP,
+                                                           int                lda,
+                                                           long long          strideA,
+                                                           const double*      BP,
+                                                           int                ldb,
+                                                           long long          strideB,
+                                                           const double*      beta,
+                                                           double*            CP,
+                                                           int                ldc,
+                                                           long long          strideC,
+                                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+    return gemm_strided_batched_scalar_arrays(hipblasDgemmStridedBatched,
+                                              handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              AP,
+                                              lda,
+                                              strideA,
+                                              BP,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              CP,
+                                              ldc,
+                                              strideC,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatchedWithScalarArrays(hipblasHandle_t       handle,
+                                                           hipblasOperation_t    transA,
+                                                           hipblasOperation_t    transB,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   k,
+                                                           const hipblasComplex* alpha,
+                                                           const hipblasComplex* AP,
+                                                           int                   lda,
+                                                           long long             strideA,
+                                                           const hipblasComplex* BP,
+                                                           int                   ldb,
+                                                           long long             strideB,
+                                                           const hipblasComplex* beta,
+                                                           hipblasComplex*       CP,
+                                                           int                   ldc,
+                                                           long long             strideC,
+                                                           int                   batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+    return gemm_strided_batched_scalar_arrays(hipblasCgemmStridedBatched,
+                                              handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              AP,
+                                              lda,
+                                              strideA,
+                                              BP,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              CP,
+                                              ldc,
+                                              strideC,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatchedWithScalarArrays(hipblasHandle_t             handle,
+                                                           hipblasOperation_t          transA,
+                                                           hipblasOperation_t          transB,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasDoubleComplex* alpha,
+                                                           const hipblasDoubleComplex* AP,
+                                                           int                         lda,
+                                                           long long                   strideA,
+                                                           const hipblasDoubleComplex* BP,
+                                                           int                         ldb,
+                                                           long long                   strideB,
+                                                           const hipblasDoubleComplex* beta,
+                                                           hipblasDoubleComplex*       CP,
+                                                           int                         ldc,
+                                                           long long                   strideC,
+                                                           int                         batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+    return gemm_strided_batched_scalar_arrays(hipblasZgemmStridedBatched,
+                                              handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              AP,
+                                              lda,
+                                              strideA,
+                                              BP,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              CP,
+                                              ldc,
+                                              strideC,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatchedWithScalarArrays_v2(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transA,
+                                                              hipblasOperation_t transB,
+                                                              int                m,
+                                                              int                n,
+                                                              int                k,
+                                                              const hipComplex*  alpha,
+                                                              const hipComplex*  AP,
+                                                              int                lda,
+                                                              long long          strideA,
+                                                              const hipComplex*  BP,
+                                                              int                ldb,
+                                                              long long          strideB,
+                                                              const hipComplex*  beta,
+                                                              hipComplex*        CP,
+                                                              int                ldc,
+                                                              long long          strideC,
+                                                              int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+    return gemm_strided_batched_scalar_arrays(hipblasCgemmStridedBatched_v2,
+                                              handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              AP,
+                                              lda,
+                                              strideA,
+                                              BP,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              CP,
+                                              ldc,
+                                              strideC,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatchedWithScalarArrays_v2(hipblasHandle_t         handle,
+                                                              hipblasOperation_t      transA,
+                                                              hipblasOperation_t      transB,
+                                                              int                     m,
+                                                              int                     n,
+                                                              int                     k,
+                                                              const hipDoubleComplex* alpha,
+                                                              const hipDoubleComplex* AP,
+                                                              int                     lda,
+                                                              long long               strideA,
+                                                              const hipDoubleComplex* BP,
+                                                              int                     ldb,
+                                                              long long               strideB,
+                                                              const hipDoubleComplex* beta,
+                                                              hipDoubleComplex*       CP,
+                                                              int                     ldc,
+                                                              long long               strideC,
+                                                              int                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+    return gemm_strided_batched_scalar_arrays(hipblasZgemmStridedBatched_v2,
+                                              handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              AP,
+                                              lda,
+                                              strideA,
+                                              BP,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              CP,
+                                              ldc,
+                                              strideC,
+                                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithScalarArrays(hipblasHandle_t      handle,
+                                                            hipblasOperation_t   transA,
+                                                            hipblasOperation_t   transB,
+                                                            int                  m,
+                                                            int                  n,
+                                                            int                  k,
+                                                            const void*          alpha,
+                                                            const void*          A,
+                                                            hipDataType          aType,
+                                                            int                  lda,
+                                                            hipblasStride        strideA,
+                                                            const void*          B,
+                                                            hipDataType          bType,
+                                                            int                  ldb,
+                                                            hipblasStride        strideB,
+                                                            const void*          beta,
+                                                            void*                C,
+                                                            hipDataType          cType,
+                                                            int                  ldc,
+                                                            hipblasStride        strideC,
+                                                            int                  batchCount,
+                                                            hipblasComputeType_t computeType,
+                                                            hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_API_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     k,
+                     aType,
+                     lda,
+                     strideA,
+                     bType,
+                     ldb,
+                     strideB,
+                     cType,
+                     ldc,
+                     strideC,
+                     batchCount,
+                     computeType,
+                     algo);
+
+    // Element sizes, to offset A, B and C to the first matrix of a run
+    size_t a_size = hipblasDatatypeSize(aType);
+    size_t b_size = hipblasDatatypeSize(bType);
+    size_t c_size = hipblasDatatypeSize(cType);
+    if(!a_size || !b_size || !c_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return gemm_scalar_runs(
+        handle,
+        alpha,
+        beta,
+        hipblasGemmExScalarSize(computeType, cType),
+        batchCount,
+        [&](int first, int count, const void* alpha_first, const void* beta_first) {
+            auto A_first = static_cast<const char*>(A) + first * strideA * a_size;
+            auto B_first = static_cast<const char*>(B) + first * strideB * b_size;
+            auto C_first = static_cast<char*>(C) + first * strideC * c_size;
+            return hipblasGemmStridedBatchedEx_v2(handle,
+                                                  transA,
+                                                  transB,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha_first,
+                                                  A_first,
+                                                  aType,
+                                                  lda,
+                                                  strideA,
+                                                  B_first,
+                                                  bType,
+                                                  ldb,
+                                                  strideB,
+                                                  beta_first,
+                                                  C_first,
+                                                  cType,
+                                                  ldc,
+                                                  strideC,
+                                                  count,
+                                                  computeType,
+                                                  algo);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithScalarArrays(hipblasHandle_t      handle,
+                                                     hipblasOperation_t   transA,
+                                                     hipblasOperation_t   transB,
+                                                     int                  m,
+                                                     int                  n,
+                                                     int                  k,
+                                                     const void*          alpha,
+                                                     const void*          A[],
+                                                     hipDataType          aType,
+                                                     int                  lda,
+                                                     const void*          B[],
+                                                     hipDataType          bType,
+                                                     int                  ldb,
+                                                     const void*          beta,
+                                                     void*                C[],
+                                                     hipDataType          cType,
+                                                     int                  ldc,
+                                                     int                  batchCount,
+                                                     hipblasComputeType_t computeType,
+                                                     hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_API_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     k,
+                     aType,
+                     lda,
+                     bType,
+                     ldb,
+                     cType,
+                     ldc,
+                     batchCount,
+                     computeType,
+                     algo);
+
+    return gemm_scalar_runs(
+        handle,
+        alpha,
+        beta,
+        hipblasGemmExScalarSize(computeType, cType),
+        batchCount,
+        [&](int first, int count, const void* alpha_first, const void* beta_first) {
+            return hipblasGemmBatchedEx_v2(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha_first,
+                                           A + first,
+                                           aType,
+                                           lda,
+                                           B + first,
+                                           bType,
+                                           ldb,
+                                           beta_first,
+                                           C + first,
+                                           cType,
+                                           ldc,
+                                           count,
+                                           computeType,
+                                           algo);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
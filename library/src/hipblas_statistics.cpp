@@ -0,0 +1,417 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "statistics.hpp"
+#include "bytes.hpp"
+#include "exceptions.hpp"
+#include "flops.hpp"
+#include "handle_state.hpp"
+#include <algorithm>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace
+{
+    // What the cost model needs to know about an exported function, worked out
+    // on its first recorded call
+    struct hipblasCostLayout
+    {
+        hipblasFunctionName      name;
+        std::vector<std::string> arg_names;
+    };
+
+    std::shared_mutex layouts_mutex;
+    std::unordered_map<const char*, std::unique_ptr<const hipblasCostLayout>> layouts;
+
+    const hipblasCostLayout& get_cost_layout(const hipblasCallRecord& record)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(layouts_mutex);
+            auto                                it = layouts.find(record.function);
+            if(it != layouts.end())
+                return *it->second;
+        }
+
+        auto layout       = std::make_unique<hipblasCostLayout>();
+        layout->arg_names = hipblasGetRecordArgNames(record);
+        hipblasParseFunctionName(record.function, layout->name);
+
+        std::unique_lock<std::shared_mutex> lock(layouts_mutex);
+        auto&                               entry = layouts[record.function];
+        if(!entry)
+            entry = std::move(layout);
+        return *entry;
+    }
+
+    // Recorded arguments of a call, looked up by their hipblas.h name
+    class hipblasCallArgs
+    {
+        const hipblasCallRecord&        record;
+        const std::vector<std::string>& names;
+
+    public:
+        hipblasCallArgs(const hipblasCallRecord& record, const std::vector<std::string>& names)
+            : record(record)
+            , names(names)
+        {
+        }
+
+        int64_t get(const char* name, int64_t default_value = 0) const
+        {
+            auto it = std::find(names.begin(), names.end(), name);
+            return it == names.end() ? default_value : record.values[it - names.begin()];
+        }
+
+        hipblasArgKind kind(const char* name) const
+        {
+            auto it = std::find(names.begin(), names.end(), name);
+            return it == names.end() ? hipblasArgKind::integer : record.kinds[it - names.begin()];
+        }
+    };
+
+    hipblasCallCost gcost(double gflops, double gbytes)
+    {
+        return {gflops * 1e9, gbytes * 1e9};
+    }
+
+    // Cost of one problem of function base with data type T. Tr is the real type
+    // matching T; real_b and real_c select the mixed real/complex variants.
+    template <typename T, typename Tr>
+    hipblasCallCost
+        blas_cost(const std::string& f, const hipblasCallArgs& args, bool real_b, bool real_c)
+    {
+        int64_t            n     = args.get("n");
+        int64_t            m     = args.get("m", n);
+        int64_t            k     = args.get("k");
+        hipblasOperation_t trans = hipblasOperation_t(args.get("trans", args.get("transA")));
+        int64_t            kside = args.get("side") == HIPBLAS_SIDE_LEFT ? m : n;
+
+        // level 1
+        if(f == "asum")
+            return gcost(asum_gflop_count<T>(n), asum_gbyte_count<T>(n));
+        if(f == "axpy")
+            return gcost(axpy_gflop_count<T>(n), axpy_gbyte_count<T>(n));
+        if(f == "copy")
+            return gcost(copy_gflop_count<T>(n), copy_gbyte_count<T>(n));
+        if(f == "dot" || f == "dotu")
+            return gcost(dot_gflop_count<false, T>(n), dot_gbyte_count<T>(n));
+        if(f == "dotc")
+            return gcost(dot_gflop_count<true, T>(n), dot_gbyte_count<T>(n));
+        if(f == "amax" || f == "amin")
+            return gcost(iamax_gflop_count<T>(n), iamax_gbyte_count<T>(n));
+        if(f == "nrm2")
+            return gcost(nrm2_gflop_count<T>(n), nrm2_gbyte_count<T>(n));
+        if(f == "rot")
+        {
+            double gflops
+                = real_c ? rot_gflop_count<T, T, Tr, Tr>(n) : rot_gflop_count<T, T, Tr, T>(n);
+            return gcost(gflops, rot_gbyte_count<T>(n));
+        }
+        if(f == "rotm") // the flag is in device or host memory, so count the full update
+            return gcost(rotm_gflop_count<Tr>(n, Tr(-1)), rotm_gbyte_count<Tr>(n, Tr(-1)));
+        if(f == "scal")
+            return gcost(real_b ? scal_gflop_count<T, Tr>(n) : scal_gflop_count<T, T>(n),
+                         scal_gbyte_count<T>(n));
+        if(f == "swap")
+            return gcost(swap_gflop_count<T>(n), swap_gbyte_count<T>(n));
+
+        // level 2
+        if(f == "gbmv")
+        {
+            int64_t kl = args.get("kl"), ku = args.get("ku");
+            return gcost(gbmv_gflop_count<T>(trans, m, n, kl, ku),
+                         gbmv_gbyte_count<T>(trans, m, n, kl, ku));
+        }
+        if(f == "gemv")
+            return gcost(gemv_gflop_count<T>(trans, m, n), gemv_gbyte_count<T>(trans, m, n));
+        if(f == "ger" || f == "geru" || f == "gerc")
+            return gcost(ger_gflop_count<T>(m, n), ger_gbyte_count<T>(m, n));
+        if(f == "hbmv")
+            return gcost(hbmv_gflop_count<T>(n, k), hbmv_gbyte_count<T>(n, k));
+        if(f == "hemv")
+            return gcost(hemv_gflop_count<T>(n), hemv_gbyte_count<T>(n));
+        if(f == "her")
+            return gcost(her_gflop_count<T>(n), her_gbyte_count<T>(n));
+        if(f == "her2")
+            return gcost(her2_gflop_count<T>(n), her2_gbyte_count<T>(n));
+        if(f == "hpmv")
+            return gcost(hpmv_gflop_count<T>(n), hpmv_gbyte_count<T>(n));
+        if(f == "hpr")
+            return gcost(hpr_gflop_count<T>(n), hpr_gbyte_count<T>(n));
+        if(f == "hpr2")
+            return gcost(hpr2_gflop_count<T>(n), hpr2_gbyte_count<T>(n));
+        if(f == "sbmv")
+            return gcost(sbmv_gflop_count<T>(n, k), sbmv_gbyte_count<T>(n, k));
+        if(f == "spmv")
+            return gcost(spmv_gflop_count<T>(n), spmv_gbyte_count<T>(n));
+        if(f == "spr")
+            return gcost(spr_gflop_count<T>(n), spr_gbyte_count<T>(n));
+        if(f == "spr2")
+            return gcost(spr2_gflop_count<T>(n), spr2_gbyte_count<T>(n));
+        if(f == "symv")
+            return gcost(symv_gflop_count<T>(n), symv_gbyte_count<T>(n));
+        if(f == "syr")
+            return gcost(syr_gflop_count<T>(n), syr_gbyte_count<T>(n));
+        if(f == "syr2")
+            return gcost(syr2_gflop_count<T>(n), syr2_gbyte_count<T>(n));
+        if(f == "tbmv")
+            return gcost(tbmv_gflop_count<T>(n, k), tbmv_gbyte_count<T>(n, k));
+        if(f == "tbsv")
+            return gcost(tbsv_gflop_count<T>(n, k), tbsv_gbyte_count<T>(n, k));
+        if(f == "tpmv")
+            return gcost(tpmv_gflop_count<T>(n), tpmv_gbyte_count<T>(n));
+        if(f == "tpsv")
+            return gcost(tpsv_gflop_count<T>(n), tpsv_gbyte_count<T>(n));
+        if(f == "trmv")
+            return gcost(trmv_gflop_count<T>(n), trmv_gbyte_count<T>(n));
+        if(f == "trsv")
+            return gcost(trsv_gflop_count<T>(n), trsv_gbyte_count<T>(n));
+
+        // level 3
+        if(f == "gemm")
+            return gcost(gemm_gflop_count<T>(m, n, k), gemm_gbyte_count<T>(m, n, k));
+        if(f == "geam")
+            return gcost(geam_gflop_count<T>(m, n), geam_gbyte_count<T>(m, n));
+        if(f == "dgmm")
+        {
+            int64_t kx = args.get("side") == HIPBLAS_SIDE_RIGHT ? n : m;
+            return gcost(dgmm_gflop_count<T>(m, n), dgmm_gbyte_count<T>(m, n, kx));
+        }
+        if(f == "hemm")
+            return gcost(hemm_gflop_count<T>(m, n, kside), hemm_gbyte_count<T>(m, n, kside));
+        if(f == "symm")
+            return gcost(symm_gflop_count<T>(m, n, kside), symm_gbyte_count<T>(m, n, kside));
+        if(f == "herk")
+            return gcost(herk_gflop_count<T>(n, k), herk_gbyte_count<T>(n, k));
+        if(f == "herkx")
+            return gcost(herkx_gflop_count<T>(n, k), herkx_gbyte_count<T>(n, k));
+        if(f == "her2k")
+            return gcost(her2k_gflop_count<T>(n, k), her2k_gbyte_count<T>(n, k));
+        if(f == "syrk")
+            return gcost(syrk_gflop_count<T>(n, k), syrk_gbyte_count<T>(n, k));
+        if(f == "syrkx")
+            return gcost(syrkx_gflop_count<T>(n, k), syrkx_gbyte_count<T>(n, k));
+        if(f == "syr2k")
+            return gcost(syr2k_gflop_count<T>(n, k), syr2k_gbyte_count<T>(n, k));
+        if(f == "trmm")
+            return gcost(trmm_gflop_count<T>(m, n, kside), trmm_gbyte_count<T>(m, n, kside));
+        if(f == "trsm")
+            return gcost(trsm_gflop_count<T>(m, n, kside), trsm_gbyte_count<T>(m, n, kside));
+        if(f == "trtri")
+            return gcost(trtri_gflop_count<T>(n), trtri_gbyte_count<T>(n));
+
+        // solver, flops only
+        if(f == "geqrf")
+            return gcost(geqrf_gflop_count<T>(n, m), 0);
+        if(f == "getrf")
+            return gcost(getrf_gflop_count<T>(n, m), 0);
+        if(f == "ormqr" || f == "unmqr")
+        {
+            bool left = args.get("side") == HIPBLAS_SIDE_LEFT;
+            return gcost(ormqr_gflop_count<T>(m, n, k, left), 0);
+        }
+        if(f == "getri")
+            return gcost(getri_gflop_count<T>(n), 0);
+        if(f == "getrs")
+            return gcost(getrs_gflop_count<T>(n, args.get("nrhs")), 0);
+        if(f == "gesv")
+            return gcost(gesv_gflop_count<T>(n, args.get("nrhs")), 0);
+        if(f == "gels")
+            return gcost(gels_gflop_count<T>(m, n), 0);
+        if(f == "potrf")
+            return gcost(potrf_gflop_count<T>(n), 0);
+        if(f == "potrs")
+            return gcost(potrs_gflop_count<T>(n, args.get("nrhs")), 0);
+
+        return {};
+    }
+
+    // Precision of a data type argument of an _ex function, or 0 if it has no cost model
+    char ex_precision(const hipblasCallArgs& args, const char* name)
+    {
+        int64_t type = args.get(name, -1);
+        switch(args.kind(name))
+        {
+        case hipblasArgKind::datatype:
+            switch(hipblasDatatype_t(type))
+            {
+            case HIPBLAS_R_16F:
+                return 'h';
+            case HIPBLAS_R_16B:
+                return 'b';
+            case HIPBLAS_R_32F:
+                return 's';
+            case HIPBLAS_R_64F:
+                return 'd';
+            case HIPBLAS_C_32F:
+                return 'c';
+            case HIPBLAS_C_64F:
+                return 'z';
+            case HIPBLAS_R_8I:
+                return 'i';
+            default:
+                return 0;
+            }
+        case hipblasArgKind::hip_datatype:
+            switch(hipDataType(type))
+            {
+            case HIP_R_16F:
+                return 'h';
+            case HIP_R_16BF:
+                return 'b';
+            case HIP_R_32F:
+                return 's';
+            case HIP_R_64F:
+                return 'd';
+            case HIP_C_32F:
+                return 'c';
+            case HIP_C_64F:
+                return 'z';
+            case HIP_R_8I:
+                return 'i';
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    }
+
+    bool is_real(char precision)
+    {
+        return precision != 'c' && precision != 'z';
+    }
+}
+
+hipblasCallCost hipblasGetCallCost(const hipblasCallRecord& record)
+{
+    const hipblasCostLayout& layout = get_cost_layout(record);
+    hipblasCallArgs          args(record, layout.arg_names);
+    const std::string&       f = layout.name.base;
+
+    char precision = layout.name.precision;
+    bool real_b    = layout.name.real_precision != 0;
+    bool real_c    = layout.name.real_c;
+    if(layout.name.ex)
+    {
+        // The data type of x for level 1 functions and of A for gemm; trsm_ex only
+        // has a compute type
+        precision = ex_precision(args, "xType");
+        if(!precision)
+            precision = ex_precision(args, "aType");
+        if(!precision)
+            precision = ex_precision(args, "computeType");
+        real_b = !is_real(precision) && is_real(ex_precision(args, "alphaType"));
+        real_c = !is_real(precision) && is_real(ex_precision(args, "csType"));
+    }
+
+    hipblasCallCost cost;
+    switch(precision)
+    {
+    case 'h':
+        cost = blas_cost<hipblasHalf, float>(f, args, real_b, real_c);
+        break;
+    case 'b':
+        cost = blas_cost<hipblasBfloat16, float>(f, args, real_b, real_c);
+        break;
+    case 's':
+        cost = blas_cost<float, float>(f, args, real_b, real_c);
+        break;
+    case 'd':
+        cost = blas_cost<double, double>(f, args, real_b, real_c);
+        break;
+    case 'c':
+        cost = blas_cost<hipblasComplex, float>(f, args, real_b, real_c);
+        break;
+    case 'z':
+        cost = blas_cost<hipblasDoubleComplex, double>(f, args, real_b, real_c);
+        break;
+    case 'i':
+        cost = blas_cost<int8_t, float>(f, args, real_b, real_c);
+        break;
+    default:
+        return cost;
+    }
+
+    double batch_count = double(args.get("batchCount", 1));
+    cost.flops *= batch_count;
+    cost.bytes *= batch_count;
+    return cost;
+}
+
+void hipblasAddCallStatistics(const hipblasCallRecord& record)
+{
+    hipblasCallCost cost = hipblasGetCallCost(record);
+    hipblasGetHandleState(record.handle)
+        ->add_call_statistics(record.function, cost.flops, cost.bytes, record.duration_ns);
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGetHandleStatistics(hipblasHandle_t            handle,
+                                           int*                       count,
+                                           hipblasFunctionStatistics* statistics)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    if(!count || (statistics && *count < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<hipblasFunctionStatistics> entries
+        = hipblasGetHandleState(handle)->get_statistics();
+    if(!statistics)
+    {
+        *count = int(entries.size());
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Most frequently called functions first
+    std::sort(entries.begin(),
+              entries.end(),
+              [](const hipblasFunctionStatistics& a, const hipblasFunctionStatistics& b) {
+                  return a.callCount > b.callCount;
+              });
+    *count = std::min(*count, int(entries.size()));
+    std::copy(entries.begin(), entries.begin() + *count, statistics);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasResetHandleStatistics(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    hipblasGetHandleState(handle)->reset_statistics();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,5321 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Host (CPU) backend for hipBLAS. All pointers passed to this backend, including
+// those the API documents as device pointers, must be host accessible. Work is
+// executed synchronously on the calling thread, split across std::threads for
+// problems large enough to amortize the thread start-up cost.
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include "gemm_ex.hpp"
+#include "logging.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using host_float_complex  = std::complex<float>;
+    using host_double_complex = std::complex<double>;
+
+    // hipblasHandle_t points to one of these when using the host backend
+    struct hostHandle
+    {
+        hipStream_t          stream       = nullptr;
+        hipblasPointerMode_t pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+        hipblasAtomicsMode_t atomics_mode = HIPBLAS_ATOMICS_NOT_ALLOWED;
+        unsigned             num_threads  = 1;
+    };
+
+    // Below this many flops a call runs on the calling thread only
+    constexpr double host_parallel_flops = 1 << 22;
+
+    // Block sizes for the cache-blocked kernels
+    constexpr int64_t gemm_mb = 64;
+    constexpr int64_t gemm_nb = 64;
+    constexpr int64_t gemm_kb = 256;
+    constexpr int64_t gemv_yb = 256;
+    constexpr int64_t trsm_nb = 32;
+
+    // Elements of T in 64 bytes, one AVX-512 or two AVX2 registers. This is the
+    // vector length of the register-blocked loops below, which are marked omp simd.
+    template <typename T>
+    constexpr int64_t host_simd_len = 64 / sizeof(T);
+
+    // The gemm micro-kernel keeps a gemm_mr x gemm_nr block of C in registers
+    template <typename T>
+    constexpr int64_t gemm_mr = host_simd_len<T>;
+    constexpr int64_t gemm_nr = 4;
+
+    unsigned host_default_num_threads()
+    {
+        // HIPBLAS_HOST_NUM_THREADS overrides the number of hardware threads
+        const char* env = std::getenv("HIPBLAS_HOST_NUM_THREADS");
+        if(env)
+        {
+            int num_threads = std::atoi(env);
+            if(num_threads > 0)
+                return unsigned(num_threads);
+        }
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    unsigned host_num_threads(hipblasHandle_t handle, double flops)
+    {
+        return flops < host_parallel_flops ? 1 : static_cast<hostHandle*>(handle)->num_threads;
+    }
+
+    // Calls func(i) for i in [0, count), distributing indices across num_threads threads
+    template <typename F>
+    void host_parallel_for(unsigned num_threads, int64_t count, F&& func)
+    {
+        unsigned thread_count = unsigned(std::min<int64_t>(num_threads, count));
+        if(thread_count <= 1)
+        {
+            for(int64_t i = 0; i < count; i++)
+                func(i);
+            return;
+        }
+
+        std::atomic<int64_t> next{0};
+        auto                 worker = [&]() {
+            for(int64_t i; (i = next++) < count;)
+                func(i);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1);
+        for(unsigned t = 1; t < thread_count; t++)
+            threads.emplace_back(worker);
+        worker();
+        for(auto& t : threads)
+            t.join();
+    }
+
+    template <typename T>
+    inline T host_conj(T x)
+    {
+        return x;
+    }
+
+    template <typename T>
+    inline std::complex<T> host_conj(std::complex<T> x)
+    {
+        return std::conj(x);
+    }
+
+    // Element (i, j) of op(A) for column-major A
+    template <typename T>
+    inline T op_elem(hipblasOperation_t trans, const T* A, int64_t lda, int64_t i, int64_t j)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return A[i + j * lda];
+        else if(trans == HIPBLAS_OP_T)
+            return A[j + i * lda];
+        else
+            return host_conj(A[j + i * lda]);
+    }
+
+    // Unit-stride dot product of op(a) and x. The sum is split across host_simd_len
+    // partial sums so that it vectorizes without an omp reduction, which complex
+    // types do not support.
+    template <bool CONJ, typename T>
+    inline T host_dot(int64_t n, const T* __restrict a, const T* __restrict x)
+    {
+        constexpr int64_t L       = host_simd_len<T>;
+        T                 part[L] = {};
+        int64_t           n0      = n - n % L;
+        for(int64_t p = 0; p < n0; p += L)
+        {
+#pragma omp simd
+            for(int64_t l = 0; l < L; l++)
+                part[l] += (CONJ ? host_conj(a[p + l]) : a[p + l]) * x[p + l];
+        }
+
+        T sum = T(0);
+        for(int64_t p = n0; p < n; p++)
+            sum += (CONJ ? host_conj(a[p]) : a[p]) * x[p];
+        for(int64_t l = 0; l < L; l++)
+            sum += part[l];
+        return sum;
+    }
+
+    // Pointer to batch instance b of a strided or pointer-array batch
+    template <typename T>
+    inline T* batch_ptr(T* p, hipblasStride stride, int64_t b)
+    {
+        return p + b * stride;
+    }
+
+    template <typename T>
+    inline T* batch_ptr(T* const* p, hipblasStride, int64_t b)
+    {
+        return p[b];
+    }
+
+    // Pointer to element 0 of a vector, accounting for negative increments
+    template <typename T>
+    inline T* vector_start(T* x, int64_t n, int64_t inc)
+    {
+        return inc < 0 ? x - (n - 1) * inc : x;
+    }
+
+    inline bool valid_operation(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+
+    inline bool valid_fill(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER;
+    }
+
+    inline bool valid_side(hipblasSideMode_t side)
+    {
+        return side == HIPBLAS_SIDE_LEFT || side == HIPBLAS_SIDE_RIGHT;
+    }
+
+    inline bool valid_diag(hipblasDiagType_t diag)
+    {
+        return diag == HIPBLAS_DIAG_NON_UNIT || diag == HIPBLAS_DIAG_UNIT;
+    }
+
+    hipblasStatus_t hipblasCopyMatrixHost(
+        int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
+    {
+        if(rows < 0 || cols < 0 || elemSize <= 0 || lda <= 0 || ldb <= 0 || lda < rows
+           || ldb < rows)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!rows || !cols)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        const char* src = static_cast<const char*>(A);
+        char*       dst = static_cast<char*>(B);
+        if(lda == rows && ldb == rows)
+        {
+            std::memcpy(dst, src, size_t(rows) * cols * elemSize);
+        }
+        else
+        {
+            for(int64_t j = 0; j < cols; j++)
+                std::memcpy(
+                    dst + j * ldb * elemSize, src + j * lda * elemSize, size_t(rows) * elemSize);
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // A vector with increment inc is a 1 x n matrix with leading dimension inc
+    hipblasStatus_t hipblasCopyVectorHost(
+        int n, int elemSize, const void* x, int incx, void* y, int incy)
+    {
+        if(n < 0 || incx <= 0 || incy <= 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return hipblasCopyMatrixHost(n ? 1 : 0, n, elemSize, x, incx, y, incy);
+    }
+
+    /******************************************************************************
+     * gemm: C = alpha * op(A) * op(B) + beta * C
+     *****************************************************************************/
+
+    // c += a * b for one gemm_mr x gemm_nr block of C, of which the leading mr x nr
+    // part is stored. a and b are packed, zero-padded panels of depth kc.
+    template <typename T>
+    inline void host_gemm_micro(int64_t              kc,
+                                const T* __restrict a,
+                                const T* __restrict b,
+                                T*                   c,
+                                int64_t              ldc,
+                                int64_t              mr,
+                                int64_t              nr)
+    {
+        constexpr int64_t MR = gemm_mr<T>;
+        T                 acc[gemm_nr][MR] = {};
+
+        for(int64_t p = 0; p < kc; p++)
+        {
+            const T* ap = a + p * MR;
+            for(int64_t jc = 0; jc < gemm_nr; jc++)
+            {
+                const T bp = b[p * gemm_nr + jc];
+#pragma omp simd
+                for(int64_t ic = 0; ic < MR; ic++)
+                    acc[jc][ic] += ap[ic] * bp;
+            }
+        }
+
+        for(int64_t jc = 0; jc < nr; jc++)
+            for(int64_t ic = 0; ic < mr; ic++)
+                c[ic + jc * ldc] += acc[jc][ic];
+    }
+
+    // Computes the mb x nb tile of C at (i0, j0). op(A) is packed into panels of
+    // gemm_mr rows and alpha * op(B) into panels of gemm_nr columns, both zero-padded,
+    // so that host_gemm_micro runs on full register blocks only.
+    template <typename T>
+    void host_gemm_tile(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int64_t            k,
+                        T                  alpha,
+                        const T*           A,
+                        int64_t            lda,
+                        const T*           B,
+                        int64_t            ldb,
+                        T                  beta,
+                        T*                 C,
+                        int64_t            ldc,
+                        int64_t            i0,
+                        int64_t            mb,
+                        int64_t            j0,
+                        int64_t            nb)
+    {
+        // beta == 0 overwrites C so that NaN or Inf in C does not propagate
+        for(int64_t j = 0; j < nb; j++)
+        {
+            T* c = C + i0 + (j0 + j) * ldc;
+            if(beta == T(0))
+                std::fill(c, c + mb, T(0));
+            else if(beta != T(1))
+                for(int64_t i = 0; i < mb; i++)
+                    c[i] *= beta;
+        }
+
+        if(alpha == T(0) || k == 0)
+            return;
+
+        constexpr int64_t MR  = gemm_mr<T>;
+        int64_t           kb  = std::min(k, gemm_kb);
+        int64_t           mbp = (mb + MR - 1) / MR * MR;
+        int64_t           nbp = (nb + gemm_nr - 1) / gemm_nr * gemm_nr;
+        std::vector<T>    Ap(mbp * kb);
+        std::vector<T>    Bp(kb * nbp);
+
+        for(int64_t kk = 0; kk < k; kk += kb)
+        {
+            int64_t kc = std::min(kb, k - kk);
+
+            for(int64_t ir = 0; ir < mbp; ir += MR)
+            {
+                T* ap = &Ap[ir * kc];
+                for(int64_t p = 0; p < kc; p++)
+                    for(int64_t ic = 0; ic < MR; ic++)
+                        ap[p * MR + ic] = ir + ic < mb
+                                              ? op_elem(transA, A, lda, i0 + ir + ic, kk + p)
+                                              : T(0);
+            }
+
+            for(int64_t jr = 0; jr < nbp; jr += gemm_nr)
+            {
+                T* bp = &Bp[jr * kc];
+                for(int64_t p = 0; p < kc; p++)
+                    for(int64_t jc = 0; jc < gemm_nr; jc++)
+                        bp[p * gemm_nr + jc]
+                            = jr + jc < nb ? alpha * op_elem(transB, B, ldb, kk + p, j0 + jr + jc)
+                                           : T(0);
+            }
+
+            for(int64_t jr = 0; jr < nb; jr += gemm_nr)
+                for(int64_t ir = 0; ir < mb; ir += MR)
+                    host_gemm_micro(kc,
+                                    &Ap[ir * kc],
+                                    &Bp[jr * kc],
+                                    C + i0 + ir + (j0 + jr) * ldc,
+                                    ldc,
+                                    std::min(MR, mb - ir),
+                                    std::min(gemm_nr, nb - jr));
+        }
+    }
+
+    template <typename T, typename TConstPtr, typename TPtr>
+    hipblasStatus_t hipblasGemmHost(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int64_t            m,
+                                    int64_t            n,
+                                    int64_t            k,
+                                    const T*           alpha,
+                                    TConstPtr          A,
+                                    int64_t            lda,
+                                    hipblasStride      strideA,
+                                    TConstPtr          B,
+                                    int64_t            ldb,
+                                    hipblasStride      strideB,
+                                    const T*           beta,
+                                    TPtr               C,
+                                    int64_t            ldc,
+                                    hipblasStride      strideC,
+                                    int64_t            batchCount)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(transA) || !valid_operation(transB))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int64_t rowsA = transA == HIPBLAS_OP_N ? m : k;
+        int64_t rowsB = transB == HIPBLAS_OP_N ? k : n;
+        if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max<int64_t>(1, rowsA)
+           || ldb < std::max<int64_t>(1, rowsB) || ldc < std::max<int64_t>(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(*alpha == T(0) && *beta == T(1))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!C || (*alpha != T(0) && k && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t tiles_m = (m + gemm_mb - 1) / gemm_mb;
+        int64_t tiles   = tiles_m * ((n + gemm_nb - 1) / gemm_nb);
+        double  flops   = 2.0 * m * n * k * batchCount;
+
+        host_parallel_for(host_num_threads(handle, flops), tiles * batchCount, [&](int64_t t) {
+            int64_t b    = t / tiles;
+            int64_t tile = t % tiles;
+            int64_t i0   = (tile % tiles_m) * gemm_mb;
+            int64_t j0   = (tile / tiles_m) * gemm_nb;
+            host_gemm_tile(transA,
+                           transB,
+                           k,
+                           *alpha,
+                           batch_ptr(A, strideA, b),
+                           lda,
+                           batch_ptr(B, strideB, b),
+                           ldb,
+                           *beta,
+                           batch_ptr(C, strideC, b),
+                           ldc,
+                           i0,
+                           std::min(gemm_mb, m - i0),
+                           j0,
+                           std::min(gemm_nb, n - j0));
+        });
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    /******************************************************************************
+     * gemm with epilogue: C = act(alpha * op(A) * op(B) + beta * C + bias), with the
+     * scale of the epilogue folded into alpha and beta by the caller
+     *****************************************************************************/
+
+    // tanh approximation of GELU, as computed by the cuBLASLt epilogue
+    template <typename T>
+    inline T host_gelu(T x)
+    {
+        const T sqrt_2_over_pi = T(0.7978845608028654);
+        return T(0.5) * x * (T(1) + std::tanh(sqrt_2_over_pi * (x + T(0.044715) * x * x * x)));
+    }
+
+    // Applies the epilogue to the mb x nb tile of C at (i0, j0), right after the tile
+    // is computed and while it is still in cache
+    template <typename T>
+    void host_gemm_epilogue_tile(const hipblasGemmEpilogue_t& epilogue,
+                                 T*                           C,
+                                 int64_t                      ldc,
+                                 int64_t                      i0,
+                                 int64_t                      mb,
+                                 int64_t                      j0,
+                                 int64_t                      nb)
+    {
+        const T* bias = static_cast<const T*>(epilogue.bias);
+        T*       aux  = static_cast<T*>(epilogue.aux);
+
+        for(int64_t j = 0; j < nb; j++)
+        {
+            T* c = C + i0 + (j0 + j) * ldc;
+            for(int64_t i = 0; i < mb; i++)
+            {
+                T x = bias ? c[i] + bias[i0 + i] : c[i];
+                if(aux)
+                    aux[i0 + i + (j0 + j) * epilogue.ldaux] = x;
+
+                if(epilogue.activation == HIPBLAS_ACTIVATION_RELU)
+                    x = std::max(x, T(0));
+                else if(epilogue.activation == HIPBLAS_ACTIVATION_GELU)
+                    x = host_gelu(x);
+                c[i] = x;
+            }
+        }
+    }
+
+    // Sizes and epilogue are checked by the caller
+    template <typename T>
+    hipblasStatus_t hipblasGemmEpilogueHost(hipblasHandle_t              handle,
+                                            hipblasOperation_t           transA,
+                                            hipblasOperation_t           transB,
+                                            int                          m,
+                                            int                          n,
+                                            int                          k,
+                                            const T*                     alpha,
+                                            const T*                     A,
+                                            int                          lda,
+                                            const T*                     B,
+                                            int                          ldb,
+                                            const T*                     beta,
+                                            T*                           C,
+                                            int                          ldc,
+                                            const hipblasGemmEpilogue_t& epilogue)
+    {
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C || (*alpha != T(0) && k && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t tiles_m = (m + gemm_mb - 1) / gemm_mb;
+        int64_t tiles   = tiles_m * ((n + gemm_nb - 1) / gemm_nb);
+        double  flops   = 2.0 * m * n * k;
+
+        host_parallel_for(host_num_threads(handle, flops), tiles, [&](int64_t tile) {
+            int64_t i0 = (tile % tiles_m) * gemm_mb;
+            int64_t j0 = (tile / tiles_m) * gemm_nb;
+            int64_t mb = std::min(gemm_mb, m - i0);
+            int64_t nb = std::min(gemm_nb, n - j0);
+            host_gemm_tile(
+                transA, transB, k, *alpha, A, lda, B, ldb, *beta, C, ldc, i0, mb, j0, nb);
+            host_gemm_epilogue_tile(epilogue, C, ldc, i0, mb, j0, nb);
+        });
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    /******************************************************************************
+     * gemv: y = alpha * op(A) * x + beta * y
+     *****************************************************************************/
+
+    // Computes elements [y0, y0 + yb) of y
+    template <typename T>
+    void host_gemv_block(hipblasOperation_t trans,
+                         int64_t            m,
+                         int64_t            n,
+                         T                  alpha,
+                         const T*           A,
+                         int64_t            lda,
+                         const T*           x,
+                         int64_t            incx,
+                         T                  beta,
+                         T*                 y,
+                         int64_t            incy,
+                         int64_t            y0,
+                         int64_t            yb)
+    {
+        int64_t        lenx = trans == HIPBLAS_OP_N ? n : m;
+        int64_t        leny = trans == HIPBLAS_OP_N ? m : n;
+        const T*       xs   = vector_start(x, lenx, incx);
+        T*             ys   = vector_start(y, leny, incy);
+        std::vector<T> acc(yb, T(0));
+
+        if(alpha != T(0))
+        {
+            if(trans == HIPBLAS_OP_N)
+            {
+                for(int64_t j = 0; j < n; j++)
+                {
+                    const T  xj = xs[j * incx];
+                    const T* a  = A + y0 + j * lda;
+#pragma omp simd
+                    for(int64_t i = 0; i < yb; i++)
+                        acc[i] += a[i] * xj;
+                }
+            }
+            else
+            {
+                // Each element of y is a dot product with x, which is made contiguous once
+                std::vector<T> xc;
+                if(incx != 1)
+                {
+                    xc.resize(m);
+                    for(int64_t p = 0; p < m; p++)
+                        xc[p] = xs[p * incx];
+                    xs = xc.data();
+                }
+                for(int64_t i = 0; i < yb; i++)
+                {
+                    const T* a = A + (y0 + i) * lda;
+                    acc[i]     = trans == HIPBLAS_OP_C ? host_dot<true>(m, a, xs)
+                                                       : host_dot<false>(m, a, xs);
+                }
+            }
+        }
+
+        for(int64_t i = 0; i < yb; i++)
+        {
+            T& yi = ys[(y0 + i) * incy];
+            yi    = alpha * acc[i] + (beta == T(0) ? T(0) : beta * yi);
+        }
+    }
+
+    template <typename T, typename TConstPtr, typename TPtr>
+    hipblasStatus_t hipblasGemvHost(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int64_t            m,
+                                    int64_t            n,
+                                    const T*           alpha,
+                                    TConstPtr          A,
+                                    int64_t            lda,
+                                    hipblasStride      strideA,
+                                    TConstPtr          x,
+                                    int64_t            incx,
+                                    hipblasStride      stridex,
+                                    const T*           beta,
+                                    TPtr               y,
+                                    int64_t            incy,
+                                    hipblasStride      stridey,
+                                    int64_t            batchCount)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(trans))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || lda < std::max<int64_t>(1, m) || !incx || !incy || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(*alpha == T(0) && *beta == T(1))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!y || (*alpha != T(0) && (!A || !x)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t leny   = trans == HIPBLAS_OP_N ? m : n;
+        int64_t blocks = (leny + gemv_yb - 1) / gemv_yb;
+        double  flops  = 2.0 * m * n * batchCount;
+
+        host_parallel_for(host_num_threads(handle, flops), blocks * batchCount, [&](int64_t t) {
+            int64_t b  = t / blocks;
+            int64_t y0 = (t % blocks) * gemv_yb;
+            host_gemv_block(trans,
+                            m,
+                            n,
+                            *alpha,
+                            batch_ptr(A, strideA, b),
+                            lda,
+                            batch_ptr(x, stridex, b),
+                            incx,
+                            *beta,
+                            batch_ptr(y, stridey, b),
+                            incy,
+                            y0,
+                            std::min(gemv_yb, leny - y0));
+        });
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    /******************************************************************************
+     * trsm: solve op(A) * X = alpha * B or X * op(A) = alpha * B, X overwrites B
+     *****************************************************************************/
+
+    // Left side, columns [j0, j0 + nb) of B. Each column of A is reused across the
+    // whole block of right-hand sides while it is in cache.
+    template <typename T>
+    void host_trsm_left_block(hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              hipblasDiagType_t  diag,
+                              int64_t            m,
+                              const T*           A,
+                              int64_t            lda,
+                              T*                 B,
+                              int64_t            ldb,
+                              int64_t            j0,
+                              int64_t            nb)
+    {
+        bool unit = diag == HIPBLAS_DIAG_UNIT;
+
+        if(transA == HIPBLAS_OP_N)
+        {
+            // Column oriented: after x(p) is known, eliminate it from the remaining rows
+            bool lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+            for(int64_t s = 0; s < m; s++)
+            {
+                int64_t  p   = lower ? s : m - 1 - s;
+                const T* a   = A + p * lda;
+                int64_t  beg = lower ? p + 1 : 0;
+                int64_t  end = lower ? m : p;
+                for(int64_t j = j0; j < j0 + nb; j++)
+                {
+                    T* b = B + j * ldb;
+                    if(!unit)
+                        b[p] /= a[p];
+                    const T x = b[p];
+#pragma omp simd
+                    for(int64_t i = beg; i < end; i++)
+                        b[i] -= x * a[i];
+                }
+            }
+        }
+        else
+        {
+            // Row i of op(A) is column i of A, so each x(i) is a unit-stride dot product
+            bool conj  = transA == HIPBLAS_OP_C;
+            bool lower = uplo == HIPBLAS_FILL_MODE_UPPER;
+            for(int64_t s = 0; s < m; s++)
+            {
+                int64_t  i   = lower ? s : m - 1 - s;
+                const T* a   = A + i * lda;
+                int64_t  beg = lower ? 0 : i + 1;
+                int64_t  end = lower ? i : m;
+                for(int64_t j = j0; j < j0 + nb; j++)
+                {
+                    T* b   = B + j * ldb;
+                    T  sum = b[i] - (conj ? host_dot<true>(end - beg, a + beg, b + beg)
+                                          : host_dot<false>(end - beg, a + beg, b + beg));
+                    b[i]   = unit ? sum : sum / (conj ? host_conj(a[i]) : a[i]);
+                }
+            }
+        }
+    }
+
+    // Right side, rows [i0, i0 + mb) of B. Every update is a unit-stride axpy
+    // between columns of B.
+    template <typename T>
+    void host_trsm_right_block(hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int64_t            n,
+                               const T*           A,
+                               int64_t            lda,
+                               T*                 B,
+                               int64_t            ldb,
+                               int64_t            i0,
+                               int64_t            mb)
+    {
+        bool unit  = diag == HIPBLAS_DIAG_UNIT;
+        bool upper = (uplo == HIPBLAS_FILL_MODE_UPPER) == (transA == HIPBLAS_OP_N);
+
+        for(int64_t s = 0; s < n; s++)
+        {
+            int64_t j   = upper ? s : n - 1 - s;
+            int64_t beg = upper ? 0 : j + 1;
+            int64_t end = upper ? j : n;
+            T*      bj  = B + i0 + j * ldb;
+            for(int64_t p = beg; p < end; p++)
+            {
+                const T  a  = op_elem(transA, A, lda, p, j);
+                const T* bp = B + i0 + p * ldb;
+#pragma omp simd
+                for(int64_t i = 0; i < mb; i++)
+                    bj[i] -= bp[i] * a;
+            }
+            if(!unit)
+            {
+                const T a = op_elem(transA, A, lda, j, j);
+#pragma omp simd
+                for(int64_t i = 0; i < mb; i++)
+                    bj[i] /= a;
+            }
+        }
+    }
+
+    template <typename T, typename TConstPtr, typename TPtr>
+    hipblasStatus_t hipblasTrsmHost(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    int64_t            m,
+                                    int64_t            n,
+                                    const T*           alpha,
+                                    TConstPtr          A,
+                                    int64_t            lda,
+                                    hipblasStride      strideA,
+                                    TPtr               B,
+                                    int64_t            ldb,
+                                    hipblasStride      strideB,
+                                    int64_t            batchCount)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_side(side) || !valid_fill(uplo) || !valid_operation(transA) || !valid_diag(diag))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        bool    left = side == HIPBLAS_SIDE_LEFT;
+        int64_t ka   = left ? m : n;
+        if(m < 0 || n < 0 || batchCount < 0 || lda < std::max<int64_t>(1, ka)
+           || ldb < std::max<int64_t>(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !B || (*alpha != T(0) && !A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // Left: columns of B are independent. Right: rows of B are independent.
+        int64_t len    = left ? n : m;
+        int64_t blocks = (len + trsm_nb - 1) / trsm_nb;
+        double  flops  = double(ka) * m * n * batchCount;
+        T       scale  = *alpha;
+
+        host_parallel_for(host_num_threads(handle, flops), blocks * batchCount, [&](int64_t t) {
+            int64_t  b  = t / blocks;
+            int64_t  r0 = (t % blocks) * trsm_nb;
+            int64_t  rb = std::min(trsm_nb, len - r0);
+            const T* a  = batch_ptr(A, strideA, b);
+            T*       x  = batch_ptr(B, strideB, b);
+
+            if(scale != T(1))
+            {
+                for(int64_t j = left ? r0 : 0; j < (left ? r0 + rb : n); j++)
+                {
+                    T* bj = x + j * ldb;
+                    for(int64_t i = left ? 0 : r0; i < (left ? m : r0 + rb); i++)
+                        bj[i] = scale == T(0) ? T(0) : bj[i] * scale;
+                }
+            }
+            if(scale == T(0))
+                return;
+
+            if(left)
+                host_trsm_left_block(uplo, transA, diag, ka, a, lda, x, ldb, r0, rb);
+            else
+                host_trsm_right_block(uplo, transA, diag, ka, a, lda, x, ldb, r0, rb);
+        });
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasCreate(hipblasHandle_t* handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    hipblasEnableLayersForNewHandle();
+
+    hostHandle* host_handle  = new hostHandle;
+    host_handle->num_threads = host_default_num_threads();
+    *handle                  = host_handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasDestroyHandleState(handle);
+    delete static_cast<hostHandle*>(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// The stream is recorded so that hipblasGetStream round-trips, but all work runs
+// synchronously on the host.
+hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    static_cast<hostHandle*>(handle)->stream = streamId;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* streamId)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!streamId)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *streamId = static_cast<hostHandle*>(handle)->stream;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// The host backend does not allocate device memory
+hipblasStatus_t hipblasSetAllocator(hipblasHandle_t       handle,
+                                    hipblasDeviceMalloc_t deviceMalloc,
+                                    hipblasDeviceFree_t   deviceFree,
+                                    void*                 userData)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!deviceMalloc != !deviceFree)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasPlanWorkspace(hipblasHandle_t           handle,
+                                     int                       count,
+                                     const hipblasPlannedCall* calls,
+                                     size_t*                   workspaceSize,
+                                     int                       reserve)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(count < 0 || (count && !calls) || !workspaceSize)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // No device memory is used
+    *workspaceSize = 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_POINTER_MODE_HOST && mode != HIPBLAS_POINTER_MODE_DEVICE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    static_cast<hostHandle*>(handle)->pointer_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = static_cast<hostHandle*>(handle)->pointer_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
+try
+{
+    HIPBLAS_API_CALL(n, elemSize, incx, incy);
+
+    return hipblasCopyVectorHost(n, elemSize, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
+try
+{
+    HIPBLAS_API_CALL(n, elemSize, incx, incy);
+
+    return hipblasCopyVectorHost(n, elemSize, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasSetMatrix(int rows, int cols, int elemSize, const void* AP, int lda, void* BP, int ldb)
+try
+{
+    HIPBLAS_API_CALL(rows, cols, elemSize, lda, ldb);
+
+    return hipblasCopyMatrixHost(rows, cols, elemSize, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasGetMatrix(int rows, int cols, int elemSize, const void* AP, int lda, void* BP, int ldb)
+try
+{
+    HIPBLAS_API_CALL(rows, cols, elemSize, lda, ldb);
+
+    return hipblasCopyMatrixHost(rows, cols, elemSize, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetVectorAsync(
+    int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
+try
+{
+    HIPBLAS_API_CALL(n, elemSize, incx, incy);
+
+    return hipblasCopyVectorHost(n, elemSize, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetVectorAsync(
+    int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
+try
+{
+    HIPBLAS_API_CALL(n, elemSize, incx, incy);
+
+    return hipblasCopyVectorHost(n, elemSize, x, incx, y, incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetMatrixAsync(int         rows,
+                                      int         cols,
+                                      int         elemSize,
+                                      const void* AP,
+                                      int         lda,
+                                      void*       BP,
+                                      int         ldb,
+                                      hipStream_t stream)
+try
+{
+    HIPBLAS_API_CALL(rows, cols, elemSize, lda, ldb);
+
+    return hipblasCopyMatrixHost(rows, cols, elemSize, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixAsync(int         rows,
+                                      int         cols,
+                                      int         elemSize,
+                                      const void* AP,
+                                      int         lda,
+                                      void*       BP,
+                                      int         ldb,
+                                      hipStream_t stream)
+try
+{
+    HIPBLAS_API_CALL(rows, cols, elemSize, lda, ldb);
+
+    return hipblasCopyMatrixHost(rows, cols, elemSize, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t atomics_mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(atomics_mode != HIPBLAS_ATOMICS_NOT_ALLOWED && atomics_mode != HIPBLAS_ATOMICS_ALLOWED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    static_cast<hostHandle*>(handle)->atomics_mode = atomics_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t* atomics_mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!atomics_mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *atomics_mode = static_cast<hostHandle*>(handle)->atomics_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// The host backend has no math modes
+hipblasStatus_t hipblasResetHandleModes(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    static_cast<hostHandle*>(handle)->atomics_mode = HIPBLAS_ATOMICS_ALLOWED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             int                m,
+                             int                n,
+                             const float*       alpha,
+                             const float*       AP,
+                             int                lda,
+                             const float*       x,
+                             int                incx,
+                             const float*       beta,
+                             float*             y,
+                             int                incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                const float*       x,
+                                int64_t            incx,
+                                const float*       beta,
+                                float*             y,
+                                int64_t            incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             int                m,
+                             int                n,
+                             const double*      alpha,
+                             const double*      AP,
+                             int                lda,
+                             const double*      x,
+                             int                incx,
+                             const double*      beta,
+                             double*            y,
+                             int                incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                const double*      x,
+                                int64_t            incx,
+                                const double*      beta,
+                                double*            y,
+                                int64_t            incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
+                             hipblasOperation_t    trans,
+                             int                   m,
+                             int                   n,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* AP,
+                             int                   lda,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             const hipblasComplex* beta,
+                             hipblasComplex*       y,
+                             int                   incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemv_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    trans,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
+                             hipblasOperation_t          trans,
+                             int                         m,
+                             int                         n,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* AP,
+                             int                         lda,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             const hipblasDoubleComplex* beta,
+                             hipblasDoubleComplex*       y,
+                             int                         incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemv_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          trans,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemv_v2(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const hipComplex*  alpha,
+                                const hipComplex*  AP,
+                                int                lda,
+                                const hipComplex*  x,
+                                int                incx,
+                                const hipComplex*  beta,
+                                hipComplex*        y,
+                                int                incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemv_v2_64(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int64_t            m,
+                                   int64_t            n,
+                                   const hipComplex*  alpha,
+                                   const hipComplex*  AP,
+                                   int64_t            lda,
+                                   const hipComplex*  x,
+                                   int64_t            incx,
+                                   const hipComplex*  beta,
+                                   hipComplex*        y,
+                                   int64_t            incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemv_v2(hipblasHandle_t         handle,
+                                hipblasOperation_t      trans,
+                                int                     m,
+                                int                     n,
+                                const hipDoubleComplex* alpha,
+                                const hipDoubleComplex* AP,
+                                int                     lda,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                const hipDoubleComplex* beta,
+                                hipDoubleComplex*       y,
+                                int                     incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemv_v2_64(hipblasHandle_t         handle,
+                                   hipblasOperation_t      trans,
+                                   int64_t                 m,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* alpha,
+                                   const hipDoubleComplex* AP,
+                                   int64_t                 lda,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   const hipDoubleComplex* beta,
+                                   hipDoubleComplex*       y,
+                                   int64_t                 incy)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                m,
+                                    int                n,
+                                    const float*       alpha,
+                                    const float* const AP[],
+                                    int                lda,
+                                    const float* const x[],
+                                    int                incx,
+                                    const float*       beta,
+                                    float* const       y[],
+                                    int                incy,
+                                    int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(
+        handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvBatched_64(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(
+        handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
+                                    hipblasOperation_t  trans,
+                                    int                 m,
+                                    int                 n,
+                                    const double*       alpha,
+                                    const double* const AP[],
+                                    int                 lda,
+                                    const double* const x[],
+                                    int                 incx,
+                                    const double*       beta,
+                                    double* const       y[],
+                                    int                 incy,
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(
+        handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvBatched_64(hipblasHandle_t     handle,
+                                       hipblasOperation_t  trans,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(
+        handle, trans, m, n, alpha, AP, lda, 0, x, incx, 0, beta, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          trans,
+                                    int                         m,
+                                    int                         n,
+                                    const hipblasComplex*       alpha,
+                                    const hipblasComplex* const AP[],
+                                    int                         lda,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    const hipblasComplex*       beta,
+                                    hipblasComplex* const       y[],
+                                    int                         incy,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvBatched_64(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
+                                    hipblasOperation_t                trans,
+                                    int                               m,
+                                    int                               n,
+                                    const hipblasDoubleComplex*       alpha,
+                                    const hipblasDoubleComplex* const AP[],
+                                    int                               lda,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    const hipblasDoubleComplex*       beta,
+                                    hipblasDoubleComplex* const       y[],
+                                    int                               incy,
+                                    int                               batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvBatched_64(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                trans,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvBatched_v2(hipblasHandle_t         handle,
+                                       hipblasOperation_t      trans,
+                                       int                     m,
+                                       int                     n,
+                                       const hipComplex*       alpha,
+                                       const hipComplex* const AP[],
+                                       int                     lda,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       const hipComplex*       beta,
+                                       hipComplex* const       y[],
+                                       int                     incy,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvBatched_v2_64(hipblasHandle_t         handle,
+                                          hipblasOperation_t      trans,
+                                          int64_t                 m,
+                                          int64_t                 n,
+                                          const hipComplex*       alpha,
+                                          const hipComplex* const AP[],
+                                          int64_t                 lda,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          const hipComplex*       beta,
+                                          hipComplex* const       y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvBatched_v2(hipblasHandle_t               handle,
+                                       hipblasOperation_t            trans,
+                                       int                           m,
+                                       int                           n,
+                                       const hipDoubleComplex*       alpha,
+                                       const hipDoubleComplex* const AP[],
+                                       int                           lda,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       const hipDoubleComplex*       beta,
+                                       hipDoubleComplex* const       y[],
+                                       int                           incy,
+                                       int                           batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvBatched_v2_64(hipblasHandle_t               handle,
+                                          hipblasOperation_t            trans,
+                                          int64_t                       m,
+                                          int64_t                       n,
+                                          const hipDoubleComplex*       alpha,
+                                          const hipDoubleComplex* const AP[],
+                                          int64_t                       lda,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          const hipDoubleComplex*       beta,
+                                          hipDoubleComplex* const       y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, trans, m, n, lda, incx, incy, batchCount);
+
+    return hipblasGemvHost(handle,
+                           trans,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)x,
+                           incx,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)y,
+                           incy,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           int                m,
+                                           int                n,
+                                           const float*       alpha,
+                                           const float*       AP,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           const float*       x,
+                                           int                incx,
+                                           hipblasStride      stridex,
+                                           const float*       beta,
+                                           float*             y,
+                                           int                incy,
+                                           hipblasStride      stridey,
+                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           x,
+                           incx,
+                           stridex,
+                           beta,
+                           y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const float*       beta,
+                                              float*             y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           x,
+                           incx,
+                           stridex,
+                           beta,
+                           y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           int                m,
+                                           int                n,
+                                           const double*      alpha,
+                                           const double*      AP,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           const double*      x,
+                                           int                incx,
+                                           hipblasStride      stridex,
+                                           const double*      beta,
+                                           double*            y,
+                                           int                incy,
+                                           hipblasStride      stridey,
+                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           x,
+                           incx,
+                           stridex,
+                           beta,
+                           y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const double*      beta,
+                                              double*            y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           x,
+                           incx,
+                           stridex,
+                           beta,
+                           y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
+                                           hipblasOperation_t    transA,
+                                           int                   m,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* AP,
+                                           int                   lda,
+                                           hipblasStride         strideA,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           const hipblasComplex* beta,
+                                           hipblasComplex*       y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           int                         m,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* AP,
+                                           int                         lda,
+                                           hipblasStride               strideA,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           const hipblasDoubleComplex* beta,
+                                           hipblasDoubleComplex*       y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvStridedBatched_v2(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int                m,
+                                              int                n,
+                                              const hipComplex*  alpha,
+                                              const hipComplex*  AP,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const hipComplex*  x,
+                                              int                incx,
+                                              hipblasStride      stridex,
+                                              const hipComplex*  beta,
+                                              hipComplex*        y,
+                                              int                incy,
+                                              hipblasStride      stridey,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvStridedBatched_v2_64(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 const hipComplex*  alpha,
+                                                 const hipComplex*  AP,
+                                                 int64_t            lda,
+                                                 hipblasStride      strideA,
+                                                 const hipComplex*  x,
+                                                 int64_t            incx,
+                                                 hipblasStride      stridex,
+                                                 const hipComplex*  beta,
+                                                 hipComplex*        y,
+                                                 int64_t            incy,
+                                                 hipblasStride      stridey,
+                                                 int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvStridedBatched_v2(hipblasHandle_t         handle,
+                                              hipblasOperation_t      transA,
+                                              int                     m,
+                                              int                     n,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* AP,
+                                              int                     lda,
+                                              hipblasStride           strideA,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              const hipDoubleComplex* beta,
+                                              hipDoubleComplex*       y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 hipblasOperation_t      transA,
+                                                 int64_t                 m,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* alpha,
+                                                 const hipDoubleComplex* AP,
+                                                 int64_t                 lda,
+                                                 hipblasStride           strideA,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 const hipDoubleComplex* beta,
+                                                 hipDoubleComplex*       y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, m, n, lda, strideA, incx, stridex, incy, stridey, batchCount);
+
+    return hipblasGemvHost(handle,
+                           transA,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)x,
+                           incx,
+                           stridex,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)y,
+                           incy,
+                           stridey,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const float*       alpha,
+                             const float*       AP,
+                             int                lda,
+                             const float*       BP,
+                             int                ldb,
+                             const float*       beta,
+                             float*             CP,
+                             int                ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(
+        handle, transA, transB, m, n, k, alpha, AP, lda, 0, BP, ldb, 0, beta, CP, ldc, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemm_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                const float*       BP,
+                                int64_t            ldb,
+                                const float*       beta,
+                                float*             CP,
+                                int64_t            ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(
+        handle, transA, transB, m, n, k, alpha, AP, lda, 0, BP, ldb, 0, beta, CP, ldc, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const double*      alpha,
+                             const double*      AP,
+                             int                lda,
+                             const double*      BP,
+                             int                ldb,
+                             const double*      beta,
+                             double*            CP,
+                             int                ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(
+        handle, transA, transB, m, n, k, alpha, AP, lda, 0, BP, ldb, 0, beta, CP, ldc, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemm_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                const double*      BP,
+                                int64_t            ldb,
+                                const double*      beta,
+                                double*            CP,
+                                int64_t            ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(
+        handle, transA, transB, m, n, k, alpha, AP, lda, 0, BP, ldb, 0, beta, CP, ldc, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
+                             hipblasOperation_t    transA,
+                             hipblasOperation_t    transB,
+                             int                   m,
+                             int                   n,
+                             int                   k,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* AP,
+                             int                   lda,
+                             const hipblasComplex* BP,
+                             int                   ldb,
+                             const hipblasComplex* beta,
+                             hipblasComplex*       CP,
+                             int                   ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    transA,
+                                hipblasOperation_t    transB,
+                                int64_t               m,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                const hipblasComplex* BP,
+                                int64_t               ldb,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       CP,
+                                int64_t               ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
+                             hipblasOperation_t          transA,
+                             hipblasOperation_t          transB,
+                             int                         m,
+                             int                         n,
+                             int                         k,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* AP,
+                             int                         lda,
+                             const hipblasDoubleComplex* BP,
+                             int                         ldb,
+                             const hipblasDoubleComplex* beta,
+                             hipblasDoubleComplex*       CP,
+                             int                         ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          transA,
+                                hipblasOperation_t          transB,
+                                int64_t                     m,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* BP,
+                                int64_t                     ldb,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       CP,
+                                int64_t                     ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm_v2(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const hipComplex*  alpha,
+                                const hipComplex*  AP,
+                                int                lda,
+                                const hipComplex*  BP,
+                                int                ldb,
+                                const hipComplex*  beta,
+                                hipComplex*        CP,
+                                int                ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm_v2_64(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int64_t            m,
+                                   int64_t            n,
+                                   int64_t            k,
+                                   const hipComplex*  alpha,
+                                   const hipComplex*  AP,
+                                   int64_t            lda,
+                                   const hipComplex*  BP,
+                                   int64_t            ldb,
+                                   const hipComplex*  beta,
+                                   hipComplex*        CP,
+                                   int64_t            ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm_v2(hipblasHandle_t         handle,
+                                hipblasOperation_t      transA,
+                                hipblasOperation_t      transB,
+                                int                     m,
+                                int                     n,
+                                int                     k,
+                                const hipDoubleComplex* alpha,
+                                const hipDoubleComplex* AP,
+                                int                     lda,
+                                const hipDoubleComplex* BP,
+                                int                     ldb,
+                                const hipDoubleComplex* beta,
+                                hipDoubleComplex*       CP,
+                                int                     ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm_v2_64(hipblasHandle_t         handle,
+                                   hipblasOperation_t      transA,
+                                   hipblasOperation_t      transB,
+                                   int64_t                 m,
+                                   int64_t                 n,
+                                   int64_t                 k,
+                                   const hipDoubleComplex* alpha,
+                                   const hipDoubleComplex* AP,
+                                   int64_t                 lda,
+                                   const hipDoubleComplex* BP,
+                                   int64_t                 ldb,
+                                   const hipDoubleComplex* beta,
+                                   hipDoubleComplex*       CP,
+                                   int64_t                 ldc)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const float*       alpha,
+                                    const float* const AP[],
+                                    int                lda,
+                                    const float* const BP[],
+                                    int                ldb,
+                                    const float*       beta,
+                                    float* const       CP[],
+                                    int                ldc,
+                                    int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           0,
+                           BP,
+                           ldb,
+                           0,
+                           beta,
+                           CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatched_64(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       const float* const BP[],
+                                       int64_t            ldb,
+                                       const float*       beta,
+                                       float* const       CP[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           0,
+                           BP,
+                           ldb,
+                           0,
+                           beta,
+                           CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
+                                    hipblasOperation_t  transA,
+                                    hipblasOperation_t  transB,
+                                    int                 m,
+                                    int                 n,
+                                    int                 k,
+                                    const double*       alpha,
+                                    const double* const AP[],
+                                    int                 lda,
+                                    const double* const BP[],
+                                    int                 ldb,
+                                    const double*       beta,
+                                    double* const       CP[],
+                                    int                 ldc,
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           0,
+                           BP,
+                           ldb,
+                           0,
+                           beta,
+                           CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatched_64(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transA,
+                                       hipblasOperation_t  transB,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       int64_t             k,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       const double* const BP[],
+                                       int64_t             ldb,
+                                       const double*       beta,
+                                       double* const       CP[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           0,
+                           BP,
+                           ldb,
+                           0,
+                           beta,
+                           CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int                         m,
+                                    int                         n,
+                                    int                         k,
+                                    const hipblasComplex*       alpha,
+                                    const hipblasComplex* const AP[],
+                                    int                         lda,
+                                    const hipblasComplex* const BP[],
+                                    int                         ldb,
+                                    const hipblasComplex*       beta,
+                                    hipblasComplex* const       CP[],
+                                    int                         ldc,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatched_64(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transA,
+                                       hipblasOperation_t          transB,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const BP[],
+                                       int64_t                     ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       CP[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
+                                    hipblasOperation_t                transA,
+                                    hipblasOperation_t                transB,
+                                    int                               m,
+                                    int                               n,
+                                    int                               k,
+                                    const hipblasDoubleComplex*       alpha,
+                                    const hipblasDoubleComplex* const AP[],
+                                    int                               lda,
+                                    const hipblasDoubleComplex* const BP[],
+                                    int                               ldb,
+                                    const hipblasDoubleComplex*       beta,
+                                    hipblasDoubleComplex* const       CP[],
+                                    int                               ldc,
+                                    int                               batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transA,
+                                       hipblasOperation_t                transB,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const BP[],
+                                       int64_t                           ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       CP[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatched_v2(hipblasHandle_t         handle,
+                                       hipblasOperation_t      transA,
+                                       hipblasOperation_t      transB,
+                                       int                     m,
+                                       int                     n,
+                                       int                     k,
+                                       const hipComplex*       alpha,
+                                       const hipComplex* const AP[],
+                                       int                     lda,
+                                       const hipComplex* const BP[],
+                                       int                     ldb,
+                                       const hipComplex*       beta,
+                                       hipComplex* const       CP[],
+                                       int                     ldc,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatched_v2_64(hipblasHandle_t         handle,
+                                          hipblasOperation_t      transA,
+                                          hipblasOperation_t      transB,
+                                          int64_t                 m,
+                                          int64_t                 n,
+                                          int64_t                 k,
+                                          const hipComplex*       alpha,
+                                          const hipComplex* const AP[],
+                                          int64_t                 lda,
+                                          const hipComplex* const BP[],
+                                          int64_t                 ldb,
+                                          const hipComplex*       beta,
+                                          hipComplex* const       CP[],
+                                          int64_t                 ldc,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_float_complex*)beta,
+                           (host_float_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatched_v2(hipblasHandle_t               handle,
+                                       hipblasOperation_t            transA,
+                                       hipblasOperation_t            transB,
+                                       int                           m,
+                                       int                           n,
+                                       int                           k,
+                                       const hipDoubleComplex*       alpha,
+                                       const hipDoubleComplex* const AP[],
+                                       int                           lda,
+                                       const hipDoubleComplex* const BP[],
+                                       int                           ldb,
+                                       const hipDoubleComplex*       beta,
+                                       hipDoubleComplex* const       CP[],
+                                       int                           ldc,
+                                       int                           batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatched_v2_64(hipblasHandle_t               handle,
+                                          hipblasOperation_t            transA,
+                                          hipblasOperation_t            transB,
+                                          int64_t                       m,
+                                          int64_t                       n,
+                                          int64_t                       k,
+                                          const hipDoubleComplex*       alpha,
+                                          const hipDoubleComplex* const AP[],
+                                          int64_t                       lda,
+                                          const hipDoubleComplex* const BP[],
+                                          int64_t                       ldb,
+                                          const hipDoubleComplex*       beta,
+                                          hipDoubleComplex* const       CP[],
+                                          int64_t                       ldc,
+                                          int64_t                       batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, transA, transB, m, n, k, lda, ldb, ldc, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (const host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           (const host_double_complex*)beta,
+                           (host_double_complex* const*)CP,
+                           ldc,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const float*       alpha,
+                                           const float*       AP,
+                                           int                lda,
+                                           long long          strideA,
+                                           const float*       BP,
+                                           int                ldb,
+                                           long long          strideB,
+                                           const float*       beta,
+                                           float*             CP,
+                                           int                ldc,
+                                           long long          strideC,
+                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           beta,
+                           CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              long long          strideA,
+                                              const float*       BP,
+                                              int64_t            ldb,
+                                              long long          strideB,
+                                              const float*       beta,
+                                              float*             CP,
+                                              int64_t            ldc,
+                                              long long          strideC,
+                                              int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           beta,
+                           CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const double*      alpha,
+                                           const double*      AP,
+                                           int                lda,
+                                           long long          strideA,
+                                           const double*      BP,
+                                           int                ldb,
+                                           long long          strideB,
+                                           const double*      beta,
+                                           double*            CP,
+                                           int                ldc,
+                                           long long          strideC,
+                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           beta,
+                           CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              long long          strideA,
+                                              const double*      BP,
+                                              int64_t            ldb,
+                                              long long          strideB,
+                                              const double*      beta,
+                                              double*            CP,
+                                              int64_t            ldc,
+                                              long long          strideC,
+                                              int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           beta,
+                           CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
+                                           hipblasOperation_t    transA,
+                                           hipblasOperation_t    transB,
+                                           int                   m,
+                                           int                   n,
+                                           int                   k,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* AP,
+                                           int                   lda,
+                                           long long             strideA,
+                                           const hipblasComplex* BP,
+                                           int                   ldb,
+                                           long long             strideB,
+                                           const hipblasComplex* beta,
+                                           hipblasComplex*       CP,
+                                           int                   ldc,
+                                           long long             strideC,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              long long             strideA,
+                                              const hipblasComplex* BP,
+                                              int64_t               ldb,
+                                              long long             strideB,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       CP,
+                                              int64_t               ldc,
+                                              long long             strideC,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           hipblasOperation_t          transB,
+                                           int                         m,
+                                           int                         n,
+                                           int                         k,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* AP,
+                                           int                         lda,
+                                           long long                   strideA,
+                                           const hipblasDoubleComplex* BP,
+                                           int                         ldb,
+                                           long long                   strideB,
+                                           const hipblasDoubleComplex* beta,
+                                           hipblasDoubleComplex*       CP,
+                                           int                         ldc,
+                                           long long                   strideC,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              long long                   strideA,
+                                              const hipblasDoubleComplex* BP,
+                                              int64_t                     ldb,
+                                              long long                   strideB,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       CP,
+                                              int64_t                     ldc,
+                                              long long                   strideC,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatched_v2(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const hipComplex*  alpha,
+                                              const hipComplex*  AP,
+                                              int                lda,
+                                              long long          strideA,
+                                              const hipComplex*  BP,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const hipComplex*  beta,
+                                              hipComplex*        CP,
+                                              int                ldc,
+                                              long long          strideC,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatched_v2_64(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 hipblasOperation_t transB,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 int64_t            k,
+                                                 const hipComplex*  alpha,
+                                                 const hipComplex*  AP,
+                                                 int64_t            lda,
+                                                 long long          strideA,
+                                                 const hipComplex*  BP,
+                                                 int64_t            ldb,
+                                                 long long          strideB,
+                                                 const hipComplex*  beta,
+                                                 hipComplex*        CP,
+                                                 int64_t            ldc,
+                                                 long long          strideC,
+                                                 int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_float_complex*)beta,
+                           (host_float_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatched_v2(hipblasHandle_t         handle,
+                                              hipblasOperation_t      transA,
+                                              hipblasOperation_t      transB,
+                                              int                     m,
+                                              int                     n,
+                                              int                     k,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* AP,
+                                              int                     lda,
+                                              long long               strideA,
+                                              const hipDoubleComplex* BP,
+                                              int                     ldb,
+                                              long long               strideB,
+                                              const hipDoubleComplex* beta,
+                                              hipDoubleComplex*       CP,
+                                              int                     ldc,
+                                              long long               strideC,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 hipblasOperation_t      transA,
+                                                 hipblasOperation_t      transB,
+                                                 int64_t                 m,
+                                                 int64_t                 n,
+                                                 int64_t                 k,
+                                                 const hipDoubleComplex* alpha,
+                                                 const hipDoubleComplex* AP,
+                                                 int64_t                 lda,
+                                                 long long               strideA,
+                                                 const hipDoubleComplex* BP,
+                                                 int64_t                 ldb,
+                                                 long long               strideB,
+                                                 const hipDoubleComplex* beta,
+                                                 hipDoubleComplex*       CP,
+                                                 int64_t                 ldc,
+                                                 long long               strideC,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, lda, strideA, ldb, strideB, ldc, strideC, batchCount);
+
+    return hipblasGemmHost(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (const host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           (const host_double_complex*)beta,
+                           (host_double_complex*)CP,
+                           ldc,
+                           strideC,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
+                             hipblasSideMode_t  side,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t transA,
+                             hipblasDiagType_t  diag,
+                             int                m,
+                             int                n,
+                             const float*       alpha,
+                             const float*       AP,
+                             int                lda,
+                             float*             BP,
+                             int                ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                const float*       AP,
+                                int64_t            lda,
+                                float*             BP,
+                                int64_t            ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
+                             hipblasSideMode_t  side,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t transA,
+                             hipblasDiagType_t  diag,
+                             int                m,
+                             int                n,
+                             const double*      alpha,
+                             const double*      AP,
+                             int                lda,
+                             double*            BP,
+                             int                ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                const double*      AP,
+                                int64_t            lda,
+                                double*            BP,
+                                int64_t            ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
+                             hipblasSideMode_t     side,
+                             hipblasFillMode_t     uplo,
+                             hipblasOperation_t    transA,
+                             hipblasDiagType_t     diag,
+                             int                   m,
+                             int                   n,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* AP,
+                             int                   lda,
+                             hipblasComplex*       BP,
+                             int                   ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (host_float_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsm_64(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* AP,
+                                int64_t               lda,
+                                hipblasComplex*       BP,
+                                int64_t               ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (host_float_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
+                             hipblasSideMode_t           side,
+                             hipblasFillMode_t           uplo,
+                             hipblasOperation_t          transA,
+                             hipblasDiagType_t           diag,
+                             int                         m,
+                             int                         n,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* AP,
+                             int                         lda,
+                             hipblasDoubleComplex*       BP,
+                             int                         ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (host_double_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsm_64(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* AP,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       BP,
+                                int64_t                     ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (host_double_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsm_v2(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                int                n,
+                                const hipComplex*  alpha,
+                                const hipComplex*  AP,
+                                int                lda,
+                                hipComplex*        BP,
+                                int                ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (host_float_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsm_v2_64(hipblasHandle_t    handle,
+                                   hipblasSideMode_t  side,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int64_t            m,
+                                   int64_t            n,
+                                   const hipComplex*  alpha,
+                                   const hipComplex*  AP,
+                                   int64_t            lda,
+                                   hipComplex*        BP,
+                                   int64_t            ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           0,
+                           (host_float_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsm_v2(hipblasHandle_t         handle,
+                                hipblasSideMode_t       side,
+                                hipblasFillMode_t       uplo,
+                                hipblasOperation_t      transA,
+                                hipblasDiagType_t       diag,
+                                int                     m,
+                                int                     n,
+                                const hipDoubleComplex* alpha,
+                                const hipDoubleComplex* AP,
+                                int                     lda,
+                                hipDoubleComplex*       BP,
+                                int                     ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (host_double_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsm_v2_64(hipblasHandle_t         handle,
+                                   hipblasSideMode_t       side,
+                                   hipblasFillMode_t       uplo,
+                                   hipblasOperation_t      transA,
+                                   hipblasDiagType_t       diag,
+                                   int64_t                 m,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* alpha,
+                                   const hipDoubleComplex* AP,
+                                   int64_t                 lda,
+                                   hipDoubleComplex*       BP,
+                                   int64_t                 ldb)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           0,
+                           (host_double_complex*)BP,
+                           ldb,
+                           0,
+                           1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    int                m,
+                                    int                n,
+                                    const float*       alpha,
+                                    const float* const AP[],
+                                    int                lda,
+                                    float* const       BP[],
+                                    int                ldb,
+                                    int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmBatched_64(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const AP[],
+                                       int64_t            lda,
+                                       float* const       BP[],
+                                       int64_t            ldb,
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t     handle,
+                                    hipblasSideMode_t   side,
+                                    hipblasFillMode_t   uplo,
+                                    hipblasOperation_t  transA,
+                                    hipblasDiagType_t   diag,
+                                    int                 m,
+                                    int                 n,
+                                    const double*       alpha,
+                                    const double* const AP[],
+                                    int                 lda,
+                                    double* const       BP[],
+                                    int                 ldb,
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmBatched_64(hipblasHandle_t     handle,
+                                       hipblasSideMode_t   side,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       hipblasDiagType_t   diag,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const AP[],
+                                       int64_t             lda,
+                                       double* const       BP[],
+                                       int64_t             ldb,
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, lda, 0, BP, ldb, 0, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int                         m,
+                                    int                         n,
+                                    const hipblasComplex*       alpha,
+                                    const hipblasComplex* const AP[],
+                                    int                         lda,
+                                    hipblasComplex* const       BP[],
+                                    int                         ldb,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmBatched_64(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const AP[],
+                                       int64_t                     lda,
+                                       hipblasComplex* const       BP[],
+                                       int64_t                     ldb,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t                   handle,
+                                    hipblasSideMode_t                 side,
+                                    hipblasFillMode_t                 uplo,
+                                    hipblasOperation_t                transA,
+                                    hipblasDiagType_t                 diag,
+                                    int                               m,
+                                    int                               n,
+                                    const hipblasDoubleComplex*       alpha,
+                                    const hipblasDoubleComplex* const AP[],
+                                    int                               lda,
+                                    hipblasDoubleComplex* const       BP[],
+                                    int                               ldb,
+                                    int                               batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasSideMode_t                 side,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       hipblasDiagType_t                 diag,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const AP[],
+                                       int64_t                           lda,
+                                       hipblasDoubleComplex* const       BP[],
+                                       int64_t                           ldb,
+                                       int64_t                           batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmBatched_v2(hipblasHandle_t         handle,
+                                       hipblasSideMode_t       side,
+                                       hipblasFillMode_t       uplo,
+                                       hipblasOperation_t      transA,
+                                       hipblasDiagType_t       diag,
+                                       int                     m,
+                                       int                     n,
+                                       const hipComplex*       alpha,
+                                       const hipComplex* const AP[],
+                                       int                     lda,
+                                       hipComplex* const       BP[],
+                                       int                     ldb,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmBatched_v2_64(hipblasHandle_t         handle,
+                                          hipblasSideMode_t       side,
+                                          hipblasFillMode_t       uplo,
+                                          hipblasOperation_t      transA,
+                                          hipblasDiagType_t       diag,
+                                          int64_t                 m,
+                                          int64_t                 n,
+                                          const hipComplex*       alpha,
+                                          const hipComplex* const AP[],
+                                          int64_t                 lda,
+                                          hipComplex* const       BP[],
+                                          int64_t                 ldb,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_float_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmBatched_v2(hipblasHandle_t               handle,
+                                       hipblasSideMode_t             side,
+                                       hipblasFillMode_t             uplo,
+                                       hipblasOperation_t            transA,
+                                       hipblasDiagType_t             diag,
+                                       int                           m,
+                                       int                           n,
+                                       const hipDoubleComplex*       alpha,
+                                       const hipDoubleComplex* const AP[],
+                                       int                           lda,
+                                       hipDoubleComplex* const       BP[],
+                                       int                           ldb,
+                                       int                           batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmBatched_v2_64(hipblasHandle_t               handle,
+                                          hipblasSideMode_t             side,
+                                          hipblasFillMode_t             uplo,
+                                          hipblasOperation_t            transA,
+                                          hipblasDiagType_t             diag,
+                                          int64_t                       m,
+                                          int64_t                       n,
+                                          const hipDoubleComplex*       alpha,
+                                          const hipDoubleComplex* const AP[],
+                                          int64_t                       lda,
+                                          hipDoubleComplex* const       BP[],
+                                          int64_t                       ldb,
+                                          int64_t                       batchCount)
+try
+{
+    HIPBLAS_API_CALL(handle, side, uplo, transA, diag, m, n, lda, ldb, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex* const*)AP,
+                           lda,
+                           0,
+                           (host_double_complex* const*)BP,
+                           ldb,
+                           0,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           int                m,
+                                           int                n,
+                                           const float*       alpha,
+                                           const float*       AP,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           float*             BP,
+                                           int                ldb,
+                                           hipblasStride      strideB,
+                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              float*             BP,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           int                m,
+                                           int                n,
+                                           const double*      alpha,
+                                           const double*      AP,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           double*            BP,
+                                           int                ldb,
+                                           hipblasStride      strideB,
+                                           int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      AP,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              double*            BP,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           alpha,
+                           AP,
+                           lda,
+                           strideA,
+                           BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
+                                           hipblasSideMode_t     side,
+                                           hipblasFillMode_t     uplo,
+                                           hipblasOperation_t    transA,
+                                           hipblasDiagType_t     diag,
+                                           int                   m,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* AP,
+                                           int                   lda,
+                                           hipblasStride         strideA,
+                                           hipblasComplex*       BP,
+                                           int                   ldb,
+                                           hipblasStride         strideB,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       BP,
+                                              int64_t               ldb,
+                                              hipblasStride         strideB,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int                         m,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* AP,
+                                           int                         lda,
+                                           hipblasStride               strideA,
+                                           hipblasDoubleComplex*       BP,
+                                           int                         ldb,
+                                           hipblasStride               strideB,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       BP,
+                                              int64_t                     ldb,
+                                              hipblasStride               strideB,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmStridedBatched_v2(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const hipComplex*  alpha,
+                                              const hipComplex*  AP,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              hipComplex*        BP,
+                                              int                ldb,
+                                              hipblasStride      strideB,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmStridedBatched_v2_64(hipblasHandle_t    handle,
+                                                 hipblasSideMode_t  side,
+                                                 hipblasFillMode_t  uplo,
+                                                 hipblasOperation_t transA,
+                                                 hipblasDiagType_t  diag,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 const hipComplex*  alpha,
+                                                 const hipComplex*  AP,
+                                                 int64_t            lda,
+                                                 hipblasStride      strideA,
+                                                 hipComplex*        BP,
+                                                 int64_t            ldb,
+                                                 hipblasStride      strideB,
+                                                 int64_t            batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_float_complex*)alpha,
+                           (const host_float_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_float_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatched_v2(hipblasHandle_t         handle,
+                                              hipblasSideMode_t       side,
+                                              hipblasFillMode_t       uplo,
+                                              hipblasOperation_t      transA,
+                                              hipblasDiagType_t       diag,
+                                              int                     m,
+                                              int                     n,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* AP,
+                                              int                     lda,
+                                              hipblasStride           strideA,
+                                              hipDoubleComplex*       BP,
+                                              int                     ldb,
+                                              hipblasStride           strideB,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 hipblasSideMode_t       side,
+                                                 hipblasFillMode_t       uplo,
+                                                 hipblasOperation_t      transA,
+                                                 hipblasDiagType_t       diag,
+                                                 int64_t                 m,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* alpha,
+                                                 const hipDoubleComplex* AP,
+                                                 int64_t                 lda,
+                                                 hipblasStride           strideA,
+                                                 hipDoubleComplex*       BP,
+                                                 int64_t                 ldb,
+                                                 hipblasStride           strideB,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, side, uplo, transA, diag, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblasTrsmHost(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const host_double_complex*)alpha,
+                           (const host_double_complex*)AP,
+                           lda,
+                           strideA,
+                           (host_double_complex*)BP,
+                           ldb,
+                           strideB,
+                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t              handle,
+                                          hipblasOperation_t           transA,
+                                          hipblasOperation_t           transB,
+                                          int                          m,
+                                          int                          n,
+                                          int                          k,
+                                          const void*                  alpha,
+                                          const void*                  A,
+                                          hipDataType                  aType,
+                                          int                          lda,
+                                          const void*                  B,
+                                          hipDataType                  bType,
+                                          int                          ldb,
+                                          const void*                  beta,
+                                          void*                        C,
+                                          hipDataType                  cType,
+                                          int                          ldc,
+                                          const hipblasGemmEpilogue_t* epilogue,
+                                          hipblasComputeType_t         computeType,
+                                          hipblasGemmAlgo_t            algo)
+try
+{
+    HIPBLAS_API_CALL(
+        handle, transA, transB, m, n, k, aType, lda, bType, ldb, cType, ldc, computeType, algo);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!valid_operation(transA) || !valid_operation(transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasStatus_t status
+        = hipblasCheckGemmEpilogue(transA, transB, m, n, k, lda, ldb, ldc, epilogue);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const hipblasGemmEpilogue_t  none = {};
+    const hipblasGemmEpilogue_t& ep   = epilogue ? *epilogue : none;
+
+    // Only real single and double precision, with bias of the same type as C
+    bool same_type = aType == cType && bType == cType && (!ep.bias || ep.biasType == cType);
+
+    // Pointers are host pointers in either pointer mode
+    hipblasGemmEpilogueScalars scalars;
+    if(ep.scale && m && n)
+    {
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        status = hipblasGemmEpilogueFoldScale(
+            ep, computeType, cType, false, nullptr, alpha, beta, scalars);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        alpha = scalars.alpha;
+        beta  = scalars.beta;
+    }
+
+    if(same_type && cType == HIP_R_32F && computeType == HIPBLAS_COMPUTE_32F)
+        return hipblasGemmEpilogueHost(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       static_cast<const float*>(alpha),
+                                       static_cast<const float*>(A),
+                                       lda,
+                                       static_cast<const float*>(B),
+                                       ldb,
+                                       static_cast<const float*>(beta),
+                                       static_cast<float*>(C),
+                                       ldc,
+                                       ep);
+    if(same_type && cType == HIP_R_64F && computeType == HIPBLAS_COMPUTE_64F)
+        return hipblasGemmEpilogueHost(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       static_cast<const double*>(alpha),
+                                       static_cast<const double*>(A),
+                                       lda,
+                                       static_cast<const double*>(B),
+                                       ldb,
+                                       static_cast<const double*>(beta),
+                                       static_cast<double*>(C),
+                                       ldc,
+                                       ep);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
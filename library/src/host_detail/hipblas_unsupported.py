@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+  Generates the host backend definitions of every hipblasStatus_t function
+  declared in hipblas.h that none of the given library sources define. Each
+  one returns HIPBLAS_STATUS_NOT_SUPPORTED so that the host library exports
+  the full hipBLAS API.
+
+  usage: hipblas_unsupported.py hipblas.h output.cpp source.cpp...
+"""
+
+import re
+import sys
+
+declaration = re.compile(r'HIPBLAS_EXPORT\s+hipblasStatus_t\s+(hipblas\w+)\s*\(([^;{}]*?)\)\s*;')
+definition = re.compile(r'(?:^|\n)(?:extern "C"\s+)?hipblasStatus_t\s+(hipblas\w+)\s*\([^;{}]*\)\s*(?:try\s*)?\{')
+comment = re.compile(r'//[^\n]*|/\*.*?\*/', re.S)
+
+
+def declarations(header):
+    with open(header) as f:
+        text = comment.sub('', f.read())
+    decls = {}
+    for m in declaration.finditer(text):
+        params = [' '.join(p.split()) for p in m.group(2).split(',')]
+        decls.setdefault(m.group(1), params)
+    return decls
+
+
+def definitions(sources):
+    names = set()
+    for source in sources:
+        with open(source) as f:
+            names.update(definition.findall(comment.sub('', f.read())))
+    return names
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: hipblas_unsupported.py hipblas.h output.cpp source.cpp...')
+
+    decls = declarations(sys.argv[1])
+    defined = definitions(sys.argv[3:])
+
+    out = ['// Generated by hipblas_unsupported.py from hipblas.h, do not edit.',
+           '',
+           '#include "hipblas.h"',
+           '',
+           'extern "C" {',
+           '']
+    for name, params in decls.items():
+        if name in defined:
+            continue
+        indent = ' ' * len('hipblasStatus_t ' + name + '(')
+        out.append('hipblasStatus_t ' + name + '(' + (',\n' + indent).join(params) + ')')
+        out.append('{')
+        out.append('    return HIPBLAS_STATUS_NOT_SUPPORTED;')
+        out.append('}')
+        out.append('')
+    out.append('} // extern "C"')
+
+    text = '\n'.join(out) + '\n'
+    try:
+        with open(sys.argv[2]) as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(sys.argv[2], 'w') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "logging.hpp"
+
+// One call to hipblasSgemm, hipblasGemmEx or hipblasGemmEx_v2 that deferred
+// batching may collect. The type arguments are the enum values passed to the
+// _ex functions and are unused for hipblasSgemm.
+struct hipblasDeferredGemm
+{
+    const char*        function; // __func__ of the exported function
+    hipblasOperation_t transA;
+    hipblasOperation_t transB;
+    int                m;
+    int                n;
+    int                k;
+    const void*        alpha;
+    const void*        A;
+    int                lda;
+    const void*        B;
+    int                ldb;
+    const void*        beta;
+    void*              C;
+    int                ldc;
+    int                aType;
+    int                bType;
+    int                cType;
+    int                computeType;
+    hipblasGemmAlgo_t  algo;
+};
+
+// True while any handle is in deferred batching mode
+inline bool hipblasDeferringGemms()
+{
+    return hipblas_layer_mode.load(std::memory_order_relaxed) & HIPBLAS_LAYER_DEFERRED_GEMM;
+}
+
+// Collects gemm if handle is in deferred batching mode. Returns true if the call
+// was collected, in which case the caller returns success without issuing it.
+bool hipblasDeferGemm(hipblasHandle_t handle, const hipblasDeferredGemm& gemm);
+
+// Issues the calls collected on handle, for changes of handle state that
+// collected calls depend on, such as the stream and pointer mode
+inline void hipblasFlushDeferredGemms(hipblasHandle_t handle)
+{
+    if(hipblasDeferringGemms())
+        hipblasFlushDeferredGemmsBefore(nullptr, handle);
+}
+
+// Issues the calls collected on handle and ends deferred batching on it. Returns
+// the first error from issuing collected calls.
+hipblasStatus_t hipblasEndDeferredGemms(hipblasHandle_t handle);
@@ -0,0 +1,313 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Size in bytes of an element of a hipblasDatatype_t or hipDataType, or 0
+inline size_t hipblasDatatypeSize(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+#ifndef HIPBLAS_V2
+inline size_t hipblasDatatypeSize(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8I:
+    case HIP_R_8U:
+        return 1;
+    case HIP_R_16F:
+    case HIP_R_16BF:
+    case HIP_C_8I:
+    case HIP_C_8U:
+        return 2;
+    case HIP_R_32F:
+    case HIP_R_32I:
+    case HIP_R_32U:
+    case HIP_C_16F:
+    case HIP_C_16BF:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+    case HIP_C_32I:
+    case HIP_C_32U:
+        return 8;
+    case HIP_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+#endif
+
+// Size in bytes of alpha and beta for a gemm_ex function with hipblasComputeType_t,
+// or 0. alpha and beta are complex when C is.
+inline size_t hipblasGemmExScalarSize(hipblasComputeType_t computeType, hipDataType cType)
+{
+    bool complex = cType == HIP_C_32F || cType == HIP_C_64F;
+    switch(computeType)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return 2;
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        return complex ? 8 : 4;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return complex ? 16 : 8;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+inline bool hipblasValidOperation(hipblasOperation_t trans)
+{
+    return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+}
+
+// Checks the arguments of every group of hipblasGemmGroupedEx, so that a group
+// with invalid operations or sizes is reported before any group is computed
+inline hipblasStatus_t hipblasCheckGemmGroups(const hipblasOperation_t transA[],
+                                              const hipblasOperation_t transB[],
+                                              const int                m[],
+                                              const int                n[],
+                                              const int                k[],
+                                              const int                lda[],
+                                              const int                ldb[],
+                                              const int                ldc[],
+                                              int                      groupCount,
+                                              const int                groupSize[])
+{
+    if(groupCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!groupCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!transA || !transB || !m || !n || !k || !lda || !ldb || !ldc || !groupSize)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    for(int g = 0; g < groupCount; g++)
+    {
+        if(!hipblasValidOperation(transA[g]) || !hipblasValidOperation(transB[g]))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int rowsA = transA[g] == HIPBLAS_OP_N ? m[g] : k[g];
+        int rowsB = transB[g] == HIPBLAS_OP_N ? k[g] : n[g];
+        if(groupSize[g] < 0 || m[g] < 0 || n[g] < 0 || k[g] < 0 || lda[g] < std::max(1, rowsA)
+           || ldb[g] < std::max(1, rowsB) || ldc[g] < std::max(1, m[g]))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// True if epilogue is null or describes no operation, in which case
+// hipblasGemmExWithEpilogue computes the same as hipblasGemmEx
+inline bool hipblasGemmEpilogueIsEmpty(const hipblasGemmEpilogue_t* epilogue)
+{
+    return !epilogue
+           || (!epilogue->bias && epilogue->activation == HIPBLAS_ACTIVATION_NONE
+               && !epilogue->scale && !epilogue->aux);
+}
+
+// True if the scale of epilogue can be folded into alpha and beta, which is how every backend
+// applies it: scale * act(x) equals act(scale * x) when there is no bias and no aux, and act
+// is the identity, or ReLU with a positive scale (checked by hipblasGemmEpilogueFoldScale)
+inline bool hipblasGemmEpilogueScaleFoldable(const hipblasGemmEpilogue_t* epilogue)
+{
+    return !epilogue || !epilogue->scale
+           || (!epilogue->bias && !epilogue->aux
+               && (epilogue->activation == HIPBLAS_ACTIVATION_NONE
+                   || epilogue->activation == HIPBLAS_ACTIVATION_RELU));
+}
+
+// Checks the sizes of hipblasGemmExWithEpilogue and that its epilogue is consistent.
+// Returns HIPBLAS_STATUS_NOT_SUPPORTED for a scale that cannot be folded into alpha and beta.
+inline hipblasStatus_t hipblasCheckGemmEpilogue(hipblasOperation_t           transA,
+                                                hipblasOperation_t           transB,
+                                                int                          m,
+                                                int                          n,
+                                                int                          k,
+                                                int                          lda,
+                                                int                          ldb,
+                                                int                          ldc,
+                                                const hipblasGemmEpilogue_t* epilogue)
+{
+    int rowsA = transA == HIPBLAS_OP_N ? m : k;
+    int rowsB = transB == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || lda < rowsA || ldb < rowsB || ldc < m)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!epilogue)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(epilogue->activation != HIPBLAS_ACTIVATION_NONE
+       && epilogue->activation != HIPBLAS_ACTIVATION_RELU
+       && epilogue->activation != HIPBLAS_ACTIVATION_GELU)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(epilogue->bias && !hipblasDatatypeSize(epilogue->biasType))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    // aux holds the values before activation, so it needs an activation
+    if(epilogue->aux
+       && (epilogue->activation == HIPBLAS_ACTIVATION_NONE || epilogue->ldaux < std::max(1, m)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!hipblasGemmEpilogueScaleFoldable(epilogue))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Host copies of alpha and beta of hipblasGemmExWithEpilogue with the scale folded in
+struct hipblasGemmEpilogueScalars
+{
+    alignas(16) char alpha[16];
+    alignas(16) char beta[16];
+};
+
+// Multiplies alpha and beta of type T by scale. A ReLU epilogue needs a positive scale.
+template <typename T>
+inline bool hipblasGemmEpilogueScaleScalars(const char* scale, bool relu, char* alpha, char* beta)
+{
+    T s, a, b;
+    std::memcpy(&s, scale, sizeof(T));
+    std::memcpy(&a, alpha, sizeof(T));
+    std::memcpy(&b, beta, sizeof(T));
+    if constexpr(std::is_arithmetic_v<T>)
+    {
+        if(relu && !(s > T(0)))
+            return false;
+    }
+    else if(relu)
+        return false;
+
+    a *= s;
+    b *= s;
+    std::memcpy(alpha, &a, sizeof(T));
+    std::memcpy(beta, &b, sizeof(T));
+    return true;
+}
+
+// Reads alpha, beta and the scale of epilogue, which follow the pointer mode of the handle,
+// and stores alpha and beta multiplied by the scale in scalars. With devicePointers the
+// values are copied from the device, which synchronizes with stream. Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED if the scale cannot be folded for computeType, or if the
+// epilogue applies a ReLU and the scale is not positive.
+inline hipblasStatus_t hipblasGemmEpilogueFoldScale(const hipblasGemmEpilogue_t& epilogue,
+                                                    hipblasComputeType_t         computeType,
+                                                    hipDataType                  cType,
+                                                    bool                         devicePointers,
+                                                    hipStream_t                  stream,
+                                                    const void*                  alpha,
+                                                    const void*                  beta,
+                                                    hipblasGemmEpilogueScalars&  scalars)
+{
+    size_t size = hipblasGemmExScalarSize(computeType, cType);
+    if(!size || !hipblasGemmEpilogueScaleFoldable(&epilogue))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    alignas(16) char scale[16];
+    if(devicePointers)
+    {
+        if(hipMemcpyAsync(scalars.alpha, alpha, size, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipMemcpyAsync(scalars.beta, beta, size, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipMemcpyAsync(scale, epilogue.scale, size, hipMemcpyDeviceToHost, stream)
+                  != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    else
+    {
+        std::memcpy(scalars.alpha, alpha, size);
+        std::memcpy(scalars.beta, beta, size);
+        std::memcpy(scale, epilogue.scale, size);
+    }
+
+    bool relu    = epilogue.activation == HIPBLAS_ACTIVATION_RELU;
+    bool complex = cType == HIP_C_32F || cType == HIP_C_64F;
+    bool folded  = false;
+    switch(computeType)
+    {
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        folded = complex ? hipblasGemmEpilogueScaleScalars<std::complex<float>>(
+                     scale, relu, scalars.alpha, scalars.beta)
+                         : hipblasGemmEpilogueScaleScalars<float>(
+                             scale, relu, scalars.alpha, scalars.beta);
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        folded = complex ? hipblasGemmEpilogueScaleScalars<std::complex<double>>(
+                     scale, relu, scalars.alpha, scalars.beta)
+                         : hipblasGemmEpilogueScaleScalars<double>(
+                             scale, relu, scalars.alpha, scalars.beta);
+        break;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        folded = hipblasGemmEpilogueScaleScalars<int32_t>(scale, relu, scalars.alpha, scalars.beta);
+        break;
+    default:
+        break;
+    }
+    return folded ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
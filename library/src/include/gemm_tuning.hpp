@@ -0,0 +1,78 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*******************************************************************************
+ * Gemm tuning database. When HIPBLAS_GEMM_TUNING is set to a nonzero value, the
+ * first gemm_ex call with new arguments times the solutions the backend offers
+ * for them and records the fastest. Results are kept by device architecture in
+ * the file named by HIPBLAS_GEMM_TUNING_DB, or $HOME/.hipblas_gemm_tuning if it
+ * is not set, so that later processes reuse them. Each line of the file is
+ *   arch transA transB m n k lda ldb ldc a_type b_type c_type compute_type flags
+ *   solution_index time_us
+ * with the backend enum values, and the last line for a key is the one used.
+ ******************************************************************************/
+
+// Arguments of a gemm_ex call that its fastest solution depends on
+struct hipblasGemmTuningKey
+{
+    static constexpr size_t num_args = 13;
+
+    std::string arch; // gcnArchName of the device, e.g. gfx90a:sramecc+:xnack-
+
+    // transA, transB, m, n, k, lda, ldb, ldc, a_type, b_type, c_type, compute_type, flags
+    std::array<int64_t, num_args> args;
+
+    bool operator==(const hipblasGemmTuningKey& rhs) const
+    {
+        return args == rhs.args && arch == rhs.arch;
+    }
+};
+
+struct hipblasGemmTuningKeyHash
+{
+    size_t operator()(const hipblasGemmTuningKey& key) const
+    {
+        uint64_t hash = std::hash<std::string>{}(key.arch);
+        for(int64_t arg : key.args)
+            hash = (hash ^ uint64_t(arg)) * 0x100000001b3ull;
+        return size_t(hash);
+    }
+};
+
+// True if HIPBLAS_GEMM_TUNING was set to a nonzero value when the library was first used
+bool hipblasGemmTuningEnabled();
+
+// Sets solution_index to the solution recorded for key and returns true, or returns false
+// if key has not been tuned. Solution index 0 is the default solution of the backend.
+bool hipblasFindTunedGemm(const hipblasGemmTuningKey& key, int32_t& solution_index);
+
+// Records solution_index as the fastest solution for key, taking time_us per call, and
+// appends it to the database file
+void hipblasAddTunedGemm(const hipblasGemmTuningKey& key, int32_t solution_index, double time_us);
@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Identifies a device memory requirement: the exported function, which also
+// fixes the data type, together with its size and mode arguments.
+// routine is expected to be __func__, so routines compare by address.
+struct hipblasWorkspaceKey
+{
+    static constexpr size_t max_args = 16;
+
+    const char*                   routine;
+    std::array<int64_t, max_args> args;
+
+    template <typename... Ts>
+    explicit hipblasWorkspaceKey(const char* routine, Ts... ts)
+        : routine(routine)
+        , args{int64_t(ts)...}
+    {
+        static_assert(sizeof...(Ts) <= max_args, "too many arguments for hipblasWorkspaceKey");
+    }
+
+    bool operator==(const hipblasWorkspaceKey& rhs) const
+    {
+        return routine == rhs.routine && args == rhs.args;
+    }
+};
+
+struct hipblasWorkspaceKeyHash
+{
+    size_t operator()(const hipblasWorkspaceKey& key) const
+    {
+        uint64_t hash = uint64_t(uintptr_t(key.routine));
+        for(int64_t arg : key.args)
+            hash = (hash ^ uint64_t(arg)) * 0x100000001b3ull;
+        return size_t(hash);
+    }
+};
+
+// Device memory functions set by hipblasSetAllocator, or hipMalloc and hipFree if none are set
+struct hipblasDeviceAllocator
+{
+    hipblasDeviceMalloc_t device_malloc = nullptr;
+    hipblasDeviceFree_t   device_free   = nullptr;
+    void*                 user_data     = nullptr;
+
+    // True if set by hipblasSetAllocator
+    bool custom() const
+    {
+        return device_malloc != nullptr;
+    }
+
+    // Returns nullptr if the memory cannot be allocated
+    void* allocate(size_t size, hipStream_t stream) const;
+
+    void free(void* ptr, hipStream_t stream) const;
+};
+
+// Device memory allocated with a custom allocator and given to the backend library as the
+// workspace of the handle
+struct hipblasUserWorkspace
+{
+    hipblasDeviceAllocator allocator;
+    void*                  memory = nullptr;
+    size_t                 size   = 0;
+};
+
+// Size of the workspace allocated by hipblasSetAllocator, unless the backend already uses more
+constexpr size_t hipblas_default_workspace_size = 4 << 20;
+
+// State hipBLAS keeps for each handle in addition to the backend handle.
+// hipblasHandle_t is the backend handle itself, so this lives in a table keyed
+// by the handle and is released by hipblasDestroy.
+class hipblasHandleState
+{
+    std::mutex                                                                mutex;
+    std::unordered_map<hipblasWorkspaceKey, size_t, hipblasWorkspaceKeyHash> workspace_sizes;
+
+    // Keyed by __func__ of the exported function
+    std::unordered_map<const char*, hipblasFunctionStatistics> statistics;
+
+    hipblasUserWorkspace user_workspace;
+
+public:
+    // Device memory size recorded for key, or 0 if none has been recorded
+    size_t get_workspace_size(const hipblasWorkspaceKey& key);
+
+    void set_workspace_size(const hipblasWorkspaceKey& key, size_t size);
+
+    void add_call_statistics(const char* function, double flops, double bytes, int64_t duration_ns);
+
+    std::vector<hipblasFunctionStatistics> get_statistics();
+
+    void reset_statistics();
+
+    hipblasUserWorkspace get_user_workspace();
+
+    // Returns the previous user workspace, which the caller frees
+    hipblasUserWorkspace exchange_user_workspace(const hipblasUserWorkspace& workspace);
+};
+
+// Returns the state for handle, creating it on first use. The pointer stays
+// valid until hipblasDestroyHandleState is called for the same handle.
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle);
+
+void hipblasDestroyHandleState(hipblasHandle_t handle);
+
+// Allows atomics and restores the default math mode of the backend handle. Defined by each
+// backend, for the handle pool to reset a handle that was used with other modes.
+extern "C" hipblasStatus_t hipblasResetHandleModes(hipblasHandle_t handle);
+
+// Device memory allocated with the allocator of a handle for the duration of a call, and
+// freed on the stream of the handle when it goes out of scope
+class hipblasDeviceScratch
+{
+    hipblasDeviceAllocator allocator;
+    hipStream_t            stream = nullptr;
+    void*                  memory = nullptr;
+
+public:
+    hipblasDeviceScratch() = default;
+
+    ~hipblasDeviceScratch()
+    {
+        allocator.free(memory, stream);
+    }
+
+    hipblasDeviceScratch(const hipblasDeviceScratch&) = delete;
+    hipblasDeviceScratch& operator=(const hipblasDeviceScratch&) = delete;
+
+    // Returns nullptr if the memory cannot be allocated. Memory from an earlier call is freed.
+    void* allocate(hipblasHandle_t handle, size_t size);
+};
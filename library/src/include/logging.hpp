@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*******************************************************************************
+ * Layer mode bits. The enabled layers are read from the HIPBLAS_LAYER
+ * environment variable when the library is loaded.
+ *   1 - trace:  one line per call with its arguments and host time,
+ *               written to HIPBLAS_LOG_TRACE_PATH or stderr
+ *   2 - bench:  one hipblas-bench command line per call,
+ *               written to HIPBLAS_LOG_BENCH_PATH or stderr
+ *   4 - statistics: per-handle call counts, flop and byte counts and latency
+ *               histograms, returned by hipblasGetHandleStatistics
+ *   8 - shapes: calls counted by function and arguments, written as a
+ *               hipblas-bench yaml file to HIPBLAS_LOG_SHAPES_PATH or stderr
+ *               at exit and by hipblasWriteShapeHistogram
+ * Calls are also recorded while callbacks are set with hipblasSetCallbacks.
+ ******************************************************************************/
+enum hipblasLayerMode : uint32_t
+{
+    HIPBLAS_LAYER_NONE       = 0x0,
+    HIPBLAS_LAYER_TRACE      = 0x1,
+    HIPBLAS_LAYER_BENCH      = 0x2,
+    HIPBLAS_LAYER_STATISTICS = 0x4,
+    HIPBLAS_LAYER_SHAPES     = 0x8,
+
+    HIPBLAS_LAYER_ENV_MASK = 0xF,
+
+    // Internal, set while any handle is in deferred batching mode
+    HIPBLAS_LAYER_DEFERRED_GEMM = 0x10000,
+
+    // Internal, set while callbacks are set with hipblasSetCallbacks
+    HIPBLAS_LAYER_CALLBACKS = 0x20000,
+
+    // Layers for which calls are recorded and timed
+    HIPBLAS_LAYER_RECORD_MASK = HIPBLAS_LAYER_ENV_MASK | HIPBLAS_LAYER_CALLBACKS,
+};
+
+// Nonzero when any layer is enabled or any handle defers gemm calls; checked on
+// entry to every exported function
+extern std::atomic<uint32_t> hipblas_layer_mode;
+
+// Enables the statistics layer if it is set in HIPBLAS_LAYER when a handle is created
+void hipblasEnableLayersForNewHandle();
+
+// How an integer argument recorded for a call is to be interpreted
+enum class hipblasArgKind : uint8_t
+{
+    integer,
+    operation,
+    fill,
+    diagonal,
+    side,
+    datatype, // hipblasDatatype_t
+    hip_datatype, // hipDataType
+    compute_type,
+    gemm_algo,
+    gemm_flags,
+};
+
+constexpr hipblasArgKind hipblas_arg_kind(hipblasOperation_t)
+{
+    return hipblasArgKind::operation;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipblasFillMode_t)
+{
+    return hipblasArgKind::fill;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipblasDiagType_t)
+{
+    return hipblasArgKind::diagonal;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipblasSideMode_t)
+{
+    return hipblasArgKind::side;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipblasDatatype_t)
+{
+    return hipblasArgKind::datatype;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipDataType)
+{
+    return hipblasArgKind::hip_datatype;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipblasComputeType_t)
+{
+    return hipblasArgKind::compute_type;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipblasGemmAlgo_t)
+{
+    return hipblasArgKind::gemm_algo;
+}
+constexpr hipblasArgKind hipblas_arg_kind(hipblasGemmFlags_t)
+{
+    return hipblasArgKind::gemm_flags;
+}
+template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+constexpr hipblasArgKind hipblas_arg_kind(T)
+{
+    return hipblasArgKind::integer;
+}
+
+// Everything recorded about one call to an exported function
+struct hipblasCallRecord
+{
+    static constexpr int max_args = 20;
+
+    const char*     function; // __func__ of the exported function
+    const char*     arg_names; // stringized argument list, including the handle if any
+    hipblasHandle_t handle;
+    int64_t         start_ns; // std::chrono::steady_clock
+    int64_t         duration_ns;
+    int             num_args;
+    hipblasArgKind  kinds[max_args];
+    int64_t         values[max_args];
+};
+
+// Canonical names of the values recorded in record, as spelled in hipblas.h
+std::vector<std::string> hipblasGetRecordArgNames(const hipblasCallRecord& record);
+
+// Parts of an exported function name, e.g. hipblasCsrotStridedBatched
+struct hipblasFunctionName
+{
+    std::string base; // "rot"
+    char        precision      = 0; // 'h', 's', 'd', 'c' or 'z'; 0 if not in the name
+    char        real_precision = 0; // 's' or 'd' if b_type is real, as in Csrot and Crot
+    bool        real_c         = false; // c_type is real as well, as in Csrot
+    bool        ex             = false;
+    bool        scalar_arrays  = false; // alpha and beta hold one scalar per batch
+    bool        epilogue       = false; // takes a hipblasGemmEpilogue_t
+    bool        api_64         = false; // takes int64_t sizes, as in Saxpy_64
+    const char* batch          = ""; // "", "_batched", "_strided_batched" or "_grouped"
+};
+
+// Returns false if function is not a hipBLAS function name
+bool hipblasParseFunctionName(const char* function, hipblasFunctionName& parsed);
+
+// Issues gemm calls collected by deferred batching on handle, or on every handle
+// if handle is nullptr, before function is called. Does nothing for the gemm
+// functions that are collected.
+void hipblasFlushDeferredGemmsBefore(const char* function, hipblasHandle_t handle);
+
+// Callbacks set by hipblasSetCallbacks
+struct hipblasCallbacks;
+
+// Created on entry to each exported function by HIPBLAS_API_CALL. When no layer
+// is enabled the constructor is a single relaxed load and a branch.
+class hipblasApiCall
+{
+    hipblasCallRecord       record;
+    bool                    active    = false;
+    const hipblasCallbacks* callbacks = nullptr; // set when begin() calls preCall
+
+    void begin();
+    void end();
+
+    void add_arg(hipblasHandle_t handle)
+    {
+        record.handle = handle;
+    }
+
+    template <typename T>
+    void add_arg(T value)
+    {
+        if(record.num_args < hipblasCallRecord::max_args)
+        {
+            record.kinds[record.num_args]  = hipblas_arg_kind(value);
+            record.values[record.num_args] = int64_t(value);
+            record.num_args++;
+        }
+    }
+
+public:
+    template <typename... Ts>
+    hipblasApiCall(const char* function, const char* arg_names, Ts... args)
+    {
+        uint32_t mode = hipblas_layer_mode.load(std::memory_order_relaxed);
+        if(mode == HIPBLAS_LAYER_NONE)
+            return;
+
+        record.function  = function;
+        record.arg_names = arg_names;
+        record.handle    = nullptr;
+        record.num_args  = 0;
+        (add_arg(args), ...);
+
+        if(mode & HIPBLAS_LAYER_DEFERRED_GEMM)
+            hipblasFlushDeferredGemmsBefore(function, record.handle);
+        if(mode & HIPBLAS_LAYER_RECORD_MASK)
+            begin();
+    }
+
+    ~hipblasApiCall()
+    {
+        if(active)
+            end();
+    }
+
+    hipblasApiCall(const hipblasApiCall&) = delete;
+    hipblasApiCall& operator=(const hipblasApiCall&) = delete;
+};
+
+// Records a call to the enclosing exported function. The arguments are the
+// handle, if the function takes one, followed by its integer and enum arguments.
+// Argument names are mapped to the names used in hipblas.h when formatted.
+#define HIPBLAS_API_CALL(...) \
+    hipblasApiCall hipblas_api_call__(__func__, #__VA_ARGS__, __VA_ARGS__)
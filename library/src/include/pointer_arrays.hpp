@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+
+// Base pointers and strides, in elements, of the matrices of a batched gemm
+struct hipblasStridedGemmBatch
+{
+    const void*   A;
+    const void*   B;
+    void*         C;
+    hipblasStride strideA;
+    hipblasStride strideB;
+    hipblasStride strideC;
+};
+
+// Returns true if the pointer arrays A, B and C of a batched gemm of batch_count matrices were
+// returned by hipblasGetStridedPointerArray on handle, with strides that are whole numbers of
+// elements of a_size, b_size and c_size bytes, and sets batch to the strided form of the call.
+// The arrays are not read, so no device memory is copied.
+bool hipblasFindStridedGemmBatch(hipblasHandle_t          handle,
+                                 int                      batch_count,
+                                 const void*              A,
+                                 size_t                   a_size,
+                                 const void*              B,
+                                 size_t                   b_size,
+                                 const void*              C,
+                                 size_t                   c_size,
+                                 hipblasStridedGemmBatch& batch);